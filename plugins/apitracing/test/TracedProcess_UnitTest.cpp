@@ -73,8 +73,8 @@ namespace ApiTracing
                                                                 pid,
                                                                 0,
                                                                 std::string(name),
-                                                                std::make_unique<std::string>(name),
-                                                                std::make_unique<std::string>(""),
+                                                                std::string(name),
+                                                                std::string(""),
                                                                 std::move(mockMemoryRegionExtractor),
                                                                 true);
     }
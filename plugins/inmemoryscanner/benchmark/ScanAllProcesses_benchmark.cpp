@@ -0,0 +1,213 @@
+#include "mock_Config.h"
+#include "mock_Dumping.h"
+#include <IYaraInterface.h>
+#include <Scanner.h>
+#include <benchmark/benchmark.h>
+#include <fmt/core.h>
+#include <future>
+#include <gmock/gmock.h>
+#include <numeric>
+#include <vmicore/os/PagingDefinitions.h>
+#include <vmicore_test/io/mock_Logger.h>
+#include <vmicore_test/os/mock_MemoryRegionExtractor.h>
+#include <vmicore_test/os/mock_PageProtection.h>
+#include <vmicore_test/plugins/mock_PluginInterface.h>
+#include <yara/limits.h> // NOLINT(modernize-deprecated-headers)
+
+using testing::_;
+using testing::NiceMock;
+using testing::Return;
+using VmiCore::ActiveProcessInformation;
+using VmiCore::addr_t;
+using VmiCore::MappedRegion;
+using VmiCore::MemoryRegion;
+using VmiCore::MockLogger;
+using VmiCore::MockMemoryRegionExtractor;
+using VmiCore::MockPageProtection;
+using VmiCore::PagingDefinitions::pageSizeInBytes;
+using VmiCore::Plugin::MockPluginInterface;
+
+namespace InMemoryScanner
+{
+    namespace
+    {
+        constexpr std::size_t regionsPerProcess = 4;
+        constexpr std::size_t smallestRegionSize = 0x10000;
+        constexpr std::size_t regionSizeClasses = 6;
+        // A single process with a large heap, which dominates the runtime of its process if scanned sequentially
+        constexpr std::size_t largeRegionSize = 0x4000000;
+        constexpr addr_t regionBaseVA = 0x7f0000000000;
+        constexpr std::size_t bytesPerMiB = 1024 * 1024;
+
+        // Serves memory from a host buffer instead of the guest, like a snapshot of the process memory
+        class BufferMemoryMapping : public VmiCore::IMemoryMapping
+        {
+          public:
+            BufferMemoryMapping(addr_t baseVA, std::span<uint8_t> buffer) : mappedRegions{MappedRegion(baseVA, buffer)}
+            {
+            }
+
+            [[nodiscard]] std::span<const MappedRegion> getMappedRegions() const override
+            {
+                return mappedRegions;
+            }
+
+            void unmap() override {}
+
+          private:
+            std::vector<MappedRegion> mappedRegions;
+        };
+
+        // Reads all bytes of a region, so that the scan cost is proportional to the region size like with yara
+        class ChecksumYaraInterface : public IYaraInterface
+        {
+          public:
+            std::vector<Rule> scanMemory(std::span<const MappedRegion> mappedRegions) override
+            {
+                uint64_t checksum = 0;
+                for (const auto& mappedRegion : mappedRegions)
+                {
+                    auto content = mappedRegion.asSpan();
+                    checksum = std::accumulate(content.begin(), content.end(), checksum);
+                }
+                benchmark::DoNotOptimize(checksum);
+                return {};
+            }
+
+            [[nodiscard]] std::size_t getMaximumMatchLength() const override
+            {
+                return YR_RE_SCAN_LIMIT;
+            }
+        };
+
+        class ScanAllProcessesFixture : public benchmark::Fixture
+        {
+          public:
+            void SetUp(benchmark::State& state) override
+            {
+                memory.assign(largeRegionSize, 0xCC);
+                pluginInterface = std::make_unique<NiceMock<MockPluginInterface>>();
+                configuration = std::make_shared<NiceMock<MockConfig>>();
+                ON_CALL(*configuration, getScanChunkSize())
+                    .WillByDefault(Return(static_cast<std::size_t>(state.range(1)) * bytesPerMiB));
+                ON_CALL(*pluginInterface, newNamedLogger(_))
+                    .WillByDefault([]() { return std::make_unique<NiceMock<MockLogger>>(); });
+                ON_CALL(*pluginInterface, mapProcessMemoryRegion(_, _, _))
+                    .WillByDefault(
+                        [this](addr_t baseVA, addr_t, std::size_t numberOfPages)
+                        {
+                            return std::make_unique<BufferMemoryMapping>(
+                                baseVA, std::span(memory).first(numberOfPages * pageSizeInBytes));
+                        });
+
+                auto processCount = static_cast<std::size_t>(state.range(0));
+                auto processes = std::make_shared<std::vector<std::shared_ptr<const ActiveProcessInformation>>>();
+                for (std::size_t pid = 1; pid <= processCount; pid++)
+                {
+                    std::vector<std::size_t> regionSizes(regionsPerProcess,
+                                                         smallestRegionSize << (pid % regionSizeClasses));
+                    if (pid == 1)
+                    {
+                        regionSizes.push_back(largeRegionSize);
+                    }
+                    processes->push_back(createProcess(static_cast<VmiCore::pid_t>(pid), regionSizes));
+                }
+                ON_CALL(*pluginInterface, getRunningProcesses()).WillByDefault(Return(processes));
+
+                scanner.emplace(pluginInterface.get(),
+                                configuration,
+                                std::make_unique<ChecksumYaraInterface>(),
+                                std::make_unique<NiceMock<MockDumping>>());
+            }
+
+            void TearDown(benchmark::State&) override
+            {
+                scanner.reset();
+                pluginInterface.reset();
+                configuration.reset();
+            }
+
+          protected:
+            std::vector<uint8_t> memory;
+            std::unique_ptr<NiceMock<MockPluginInterface>> pluginInterface;
+            std::shared_ptr<NiceMock<MockConfig>> configuration;
+            std::optional<Scanner> scanner;
+
+          private:
+            static std::shared_ptr<const ActiveProcessInformation> createProcess(VmiCore::pid_t pid,
+                                                                                 std::vector<std::size_t> regionSizes)
+            {
+                auto memoryRegionExtractor = std::make_unique<NiceMock<MockMemoryRegionExtractor>>();
+                ON_CALL(*memoryRegionExtractor, extractAllMemoryRegions())
+                    .WillByDefault(
+                        [regionSizes]()
+                        {
+                            auto memoryRegions = std::make_unique<std::vector<MemoryRegion>>();
+                            auto base = regionBaseVA;
+                            for (auto regionSize : regionSizes)
+                            {
+                                memoryRegions->emplace_back(base,
+                                                            regionSize,
+                                                            "",
+                                                            std::make_unique<NiceMock<MockPageProtection>>(),
+                                                            false,
+                                                            false,
+                                                            false);
+                                base += regionSize;
+                            }
+                            return memoryRegions;
+                        });
+                auto processName = fmt::format("process{}.exe", pid);
+                return std::make_shared<const ActiveProcessInformation>(
+                    ActiveProcessInformation{0,
+                                             0,
+                                             0,
+                                             pid,
+                                             0,
+                                             processName,
+                                             std::string(processName),
+                                             std::string(""),
+                                             std::move(memoryRegionExtractor),
+                                             false});
+            }
+        };
+    }
+
+    // Reproduces the former scheduling with one asynchronous task per process
+    BENCHMARK_DEFINE_F(ScanAllProcessesFixture, perProcessAsync)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            std::vector<std::future<void>> scanProcessAsyncTasks;
+            for (const auto& process : *pluginInterface->getRunningProcesses())
+            {
+                scanProcessAsyncTasks.push_back(std::async(&Scanner::scanProcess, &*scanner, process));
+            }
+            for (auto& currentTask : scanProcessAsyncTasks)
+            {
+                currentTask.get();
+            }
+        }
+    }
+
+    BENCHMARK_DEFINE_F(ScanAllProcessesFixture, regionWorkStealingPool)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            scanner->scanAllProcesses();
+        }
+    }
+
+    // Arguments: number of processes, scan chunk size in MiB
+    BENCHMARK_REGISTER_F(ScanAllProcessesFixture, perProcessAsync)
+        ->ArgNames({"processes", "chunkMiB"})
+        ->Args({64, 0})
+        ->Args({256, 0})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+    BENCHMARK_REGISTER_F(ScanAllProcessesFixture, regionWorkStealingPool)
+        ->ArgNames({"processes", "chunkMiB"})
+        ->ArgsProduct({{64, 256}, {0, 8}})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+}
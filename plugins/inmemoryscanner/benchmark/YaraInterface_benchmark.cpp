@@ -0,0 +1,160 @@
+#include <YaraInterface.h>
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <optional>
+#include <stdexcept>
+#include <vmicore/os/PagingDefinitions.h>
+
+using VmiCore::addr_t;
+using VmiCore::MappedRegion;
+using VmiCore::PagingDefinitions::pageSizeInBytes;
+
+namespace InMemoryScanner
+{
+    namespace
+    {
+        constexpr addr_t regionBaseVA = 0x7f0000000000;
+        constexpr auto* benchmarkRules = R"(
+                        rule benchmarkRule
+                        {
+                            strings:
+                                $test = "InMemoryScannerBenchmark"
+
+                            condition:
+                                all of them
+                        }
+                    )";
+
+        // YaraInterface only loads compiled rules from disk
+        std::string compileBenchmarkRules()
+        {
+            auto fileName = (std::filesystem::temp_directory_path() / "inmemoryscanner-benchmark.sigs").string();
+
+            if (yr_initialize() != ERROR_SUCCESS)
+            {
+                throw std::runtime_error("Unable to initialize libyara");
+            }
+            YR_COMPILER* compiler = nullptr;
+            if (yr_compiler_create(&compiler) != ERROR_SUCCESS)
+            {
+                throw std::runtime_error("Unable to create yara compiler");
+            }
+            if (yr_compiler_add_string(compiler, benchmarkRules, nullptr) > 0)
+            {
+                throw std::runtime_error("Benchmark rules are faulty");
+            }
+            YR_RULES* compiledRules = nullptr;
+            if (yr_compiler_get_rules(compiler, &compiledRules) != ERROR_SUCCESS ||
+                yr_rules_save(compiledRules, fileName.c_str()) != ERROR_SUCCESS)
+            {
+                throw std::runtime_error("Unable to save rules to file");
+            }
+            yr_compiler_destroy(compiler);
+            yr_finalize();
+
+            return fileName;
+        }
+
+        YR_MEMORY_BLOCK* getSingleBlock(YR_MEMORY_BLOCK_ITERATOR* iterator)
+        {
+            return static_cast<YR_MEMORY_BLOCK*>(iterator->context);
+        }
+
+        YR_MEMORY_BLOCK* getNoFurtherBlock([[maybe_unused]] YR_MEMORY_BLOCK_ITERATOR* iterator)
+        {
+            return nullptr;
+        }
+
+        const uint8_t* fetchBlockData(YR_MEMORY_BLOCK* block)
+        {
+            return static_cast<const uint8_t*>(block->context);
+        }
+
+        int ignoreScanMessages([[maybe_unused]] YR_SCAN_CONTEXT* context,
+                               [[maybe_unused]] int message,
+                               [[maybe_unused]] void* messageData,
+                               [[maybe_unused]] void* userData)
+        {
+            return CALLBACK_CONTINUE;
+        }
+
+        // Scans regions without any match, so that the fixed cost per region dominates for small regions
+        class YaraInterfaceFixture : public benchmark::Fixture
+        {
+          public:
+            void SetUp(benchmark::State& state) override
+            {
+                memory.assign(static_cast<std::size_t>(state.range(0)) * pageSizeInBytes, 0xCC);
+                mappedRegions = {MappedRegion(regionBaseVA, memory)};
+                auto rulesFile = compileBenchmarkRules();
+                yaraInterface.emplace(rulesFile, 0, false);
+                prefilteredYaraInterface.emplace(rulesFile, 0, true);
+                if (yr_rules_load(rulesFile.c_str(), &rules) != ERROR_SUCCESS)
+                {
+                    throw std::runtime_error("Unable to load rules");
+                }
+            }
+
+            void TearDown(benchmark::State&) override
+            {
+                yr_rules_destroy(rules);
+                rules = nullptr;
+                yaraInterface.reset();
+                prefilteredYaraInterface.reset();
+            }
+
+          protected:
+            std::vector<uint8_t> memory;
+            std::vector<MappedRegion> mappedRegions;
+            std::optional<YaraInterface> yaraInterface;
+            std::optional<YaraInterface> prefilteredYaraInterface;
+            YR_RULES* rules = nullptr;
+        };
+    }
+
+    // Reproduces the former setup of a new scan context for every region
+    BENCHMARK_DEFINE_F(YaraInterfaceFixture, scanContextPerRegion)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            YR_MEMORY_BLOCK block{memory.size(), regionBaseVA, memory.data(), &fetchBlockData};
+            YR_MEMORY_BLOCK_ITERATOR iterator{.context = &block,
+                                              .first = &getSingleBlock,
+                                              .next = &getNoFurtherBlock,
+                                              .file_size = nullptr,
+                                              .last_error = ERROR_SUCCESS};
+            benchmark::DoNotOptimize(yr_rules_scan_mem_blocks(rules,
+                                                              &iterator,
+                                                              SCAN_FLAGS_PROCESS_MEMORY |
+                                                                  SCAN_FLAGS_REPORT_RULES_MATCHING,
+                                                              &ignoreScanMessages,
+                                                              nullptr,
+                                                              0));
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK_DEFINE_F(YaraInterfaceFixture, reusedScanner)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(yaraInterface->scanMemory(mappedRegions));
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Memory without any literal of the rules is not handed to yara at all
+    BENCHMARK_DEFINE_F(YaraInterfaceFixture, literalPrefilter)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(prefilteredYaraInterface->scanMemory(mappedRegions));
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Argument: region size in pages
+    BENCHMARK_REGISTER_F(YaraInterfaceFixture, scanContextPerRegion)->ArgName("pages")->Arg(1)->Arg(16)->Arg(256);
+    BENCHMARK_REGISTER_F(YaraInterfaceFixture, reusedScanner)->ArgName("pages")->Arg(1)->Arg(16)->Arg(256);
+    BENCHMARK_REGISTER_F(YaraInterfaceFixture, literalPrefilter)->ArgName("pages")->Arg(1)->Arg(16)->Arg(256);
+}
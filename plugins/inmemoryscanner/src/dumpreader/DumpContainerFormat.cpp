@@ -0,0 +1,180 @@
+#include "DumpContainerFormat.h"
+#include <algorithm>
+#include <concepts>
+
+namespace InMemoryScanner::DumpContainer
+{
+    namespace
+    {
+        constexpr uint8_t sharedMemoryFlag = 1U << 0;
+        constexpr uint8_t beingDeletedFlag = 1U << 1;
+        constexpr uint8_t processBaseImageFlag = 1U << 2;
+
+        class Encoder
+        {
+          public:
+            template <std::unsigned_integral T> void put(T value)
+            {
+                for (std::size_t i = 0; i < sizeof(T); i++)
+                {
+                    data.push_back(static_cast<uint8_t>(value >> (8 * i)));
+                }
+            }
+
+            void put(std::span<const uint8_t> bytes)
+            {
+                data.insert(data.end(), bytes.begin(), bytes.end());
+            }
+
+            void put(const std::string& string)
+            {
+                put(static_cast<uint32_t>(string.size()));
+                data.insert(data.end(), string.begin(), string.end());
+            }
+
+            std::vector<uint8_t> data;
+        };
+
+        class Decoder
+        {
+          public:
+            explicit Decoder(std::span<const uint8_t> data) : data(data) {}
+
+            template <std::unsigned_integral T> T get()
+            {
+                auto bytes = take(sizeof(T));
+                T value = 0;
+                for (std::size_t i = 0; i < sizeof(T); i++)
+                {
+                    value |= static_cast<T>(static_cast<T>(bytes[i]) << (8 * i));
+                }
+                return value;
+            }
+
+            std::string getString()
+            {
+                auto bytes = take(get<uint32_t>());
+                return {bytes.begin(), bytes.end()};
+            }
+
+            // Every element occupies at least one byte, which bounds counts read from corrupted data
+            std::size_t getCount()
+            {
+                auto count = get<uint64_t>();
+                if (count > data.size())
+                {
+                    throw FormatException("Unexpected end of dump container data");
+                }
+                return static_cast<std::size_t>(count);
+            }
+
+            std::span<const uint8_t> take(std::size_t size)
+            {
+                if (size > data.size())
+                {
+                    throw FormatException("Unexpected end of dump container data");
+                }
+                auto bytes = data.first(size);
+                data = data.subspan(size);
+                return bytes;
+            }
+
+          private:
+            std::span<const uint8_t> data;
+        };
+    }
+
+    std::vector<uint8_t> serializeHeader(const Header& header)
+    {
+        Encoder encoder;
+        encoder.put(magic);
+        encoder.put(header.version);
+        encoder.put(uint32_t{0});
+        encoder.put(header.indexOffset);
+        encoder.put(header.indexSize);
+        return std::move(encoder.data);
+    }
+
+    Header parseHeader(std::span<const uint8_t> data)
+    {
+        Decoder decoder(data);
+        if (!std::ranges::equal(decoder.take(magic.size()), magic))
+        {
+            throw FormatException("Not a dump container");
+        }
+        Header header{};
+        header.version = decoder.get<uint32_t>();
+        if (header.version != formatVersion)
+        {
+            throw FormatException("Unsupported dump container version " + std::to_string(header.version));
+        }
+        decoder.get<uint32_t>();
+        header.indexOffset = decoder.get<uint64_t>();
+        header.indexSize = decoder.get<uint64_t>();
+        return header;
+    }
+
+    std::vector<uint8_t> serializeIndex(std::span<const RegionEntry> regions)
+    {
+        Encoder encoder;
+        encoder.put(static_cast<uint64_t>(regions.size()));
+        for (const auto& region : regions)
+        {
+            encoder.put(region.pid);
+            encoder.put(region.regionId);
+            encoder.put(region.baseVA);
+            encoder.put(region.size);
+            encoder.put(static_cast<uint8_t>((region.isSharedMemory ? sharedMemoryFlag : 0) |
+                                             (region.isBeingDeleted ? beingDeletedFlag : 0) |
+                                             (region.isProcessBaseImage ? processBaseImageFlag : 0)));
+            encoder.put(region.protection);
+            encoder.put(region.processName);
+            encoder.put(region.moduleName);
+            encoder.put(static_cast<uint64_t>(region.extents.size()));
+            for (const auto& extent : region.extents)
+            {
+                encoder.put(extent.firstPage);
+                encoder.put(extent.numberOfPages);
+                encoder.put(static_cast<uint8_t>(extent.type));
+                encoder.put(extent.fileOffset);
+                encoder.put(extent.storedSize);
+            }
+        }
+        return std::move(encoder.data);
+    }
+
+    std::vector<RegionEntry> parseIndex(std::span<const uint8_t> data)
+    {
+        Decoder decoder(data);
+        std::vector<RegionEntry> regions(decoder.getCount());
+        for (auto& region : regions)
+        {
+            region.pid = decoder.get<uint32_t>();
+            region.regionId = decoder.get<uint32_t>();
+            region.baseVA = decoder.get<uint64_t>();
+            region.size = decoder.get<uint64_t>();
+            auto flags = decoder.get<uint8_t>();
+            region.isSharedMemory = (flags & sharedMemoryFlag) != 0;
+            region.isBeingDeleted = (flags & beingDeletedFlag) != 0;
+            region.isProcessBaseImage = (flags & processBaseImageFlag) != 0;
+            region.protection = decoder.getString();
+            region.processName = decoder.getString();
+            region.moduleName = decoder.getString();
+            region.extents.resize(decoder.getCount());
+            for (auto& extent : region.extents)
+            {
+                extent.firstPage = decoder.get<uint64_t>();
+                extent.numberOfPages = decoder.get<uint32_t>();
+                auto type = decoder.get<uint8_t>();
+                if (type > static_cast<uint8_t>(ExtentType::Raw))
+                {
+                    throw FormatException("Unknown page extent type " + std::to_string(type));
+                }
+                extent.type = static_cast<ExtentType>(type);
+                extent.fileOffset = decoder.get<uint64_t>();
+                extent.storedSize = decoder.get<uint64_t>();
+            }
+        }
+        return regions;
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * Layout of a dump container. All integers are stored in little endian byte order. A container is only ever
+ * appended to, so it can be written through the file transport of VMICore.
+ *
+ * | Part    | Content                                                                                   |
+ * | ------- | ----------------------------------------------------------------------------------------- |
+ * | Header  | Magic and format version. The index location is always zero.                              |
+ * | Frames  | Page data of all regions. Frames of different regions may be interleaved.                 |
+ * | Index   | One entry per dumped region, each listing the page extents the region consists of.        |
+ * | Trailer | Same layout as the header but with the location of the index. Only present once the       |
+ * |         | container has been completed.                                                             |
+ */
+namespace InMemoryScanner::DumpContainer
+{
+    constexpr std::array<uint8_t, 8> magic{'I', 'M', 'S', 'D', 'U', 'M', 'P', '\0'};
+    constexpr uint32_t formatVersion = 2;
+    constexpr std::size_t headerSize = 32;
+    constexpr std::size_t pageSize = 4096;
+
+    class FormatException : public std::runtime_error
+    {
+      public:
+        explicit FormatException(const std::string& message) : std::runtime_error(message) {};
+    };
+
+    enum class ExtentType : uint8_t
+    {
+        /// Pages consisting only of zeros, no data is stored.
+        Zero = 0,
+        /// A single zstd frame containing the pages.
+        Zstd = 1,
+        /// The pages stored verbatim, used when compression does not reduce the size.
+        Raw = 2
+    };
+
+    /**
+     * A run of consecutive pages inside a region. Pages of a region that are not covered by any extent were not
+     * mapped in the guest.
+     */
+    struct PageExtent
+    {
+        /// Index of the first page relative to the region base.
+        uint64_t firstPage;
+        uint32_t numberOfPages;
+        ExtentType type;
+        /// Location of the stored data inside the container. Zero for extents of type Zero.
+        uint64_t fileOffset;
+        uint64_t storedSize;
+
+        bool operator==(const PageExtent& rhs) const = default;
+    };
+
+    struct RegionEntry
+    {
+        uint32_t pid;
+        uint32_t regionId;
+        uint64_t baseVA;
+        uint64_t size;
+        bool isSharedMemory;
+        bool isBeingDeleted;
+        bool isProcessBaseImage;
+        std::string protection;
+        std::string processName;
+        std::string moduleName;
+        /// Sorted by firstPage, extents never overlap.
+        std::vector<PageExtent> extents;
+
+        bool operator==(const RegionEntry& rhs) const = default;
+    };
+
+    /**
+     * Content of both the header and the trailer.
+     */
+    struct Header
+    {
+        uint32_t version;
+        uint64_t indexOffset;
+        uint64_t indexSize;
+    };
+
+    [[nodiscard]] std::vector<uint8_t> serializeHeader(const Header& header);
+
+    [[nodiscard]] Header parseHeader(std::span<const uint8_t> data);
+
+    [[nodiscard]] std::vector<uint8_t> serializeIndex(std::span<const RegionEntry> regions);
+
+    [[nodiscard]] std::vector<RegionEntry> parseIndex(std::span<const uint8_t> data);
+}
@@ -0,0 +1,138 @@
+#include "DumpContainerReader.h"
+#include <algorithm>
+#include <stdexcept>
+#include <zstd.h>
+
+using InMemoryScanner::DumpContainer::ExtentType;
+using InMemoryScanner::DumpContainer::FormatException;
+using InMemoryScanner::DumpContainer::PageExtent;
+using InMemoryScanner::DumpContainer::RegionEntry;
+
+namespace InMemoryScanner
+{
+    DumpContainerReader::DumpContainerReader(const std::filesystem::path& containerPath)
+        : container(containerPath, std::ios::binary)
+    {
+        if (!container.is_open())
+        {
+            throw std::runtime_error("Unable to open dump container " + containerPath.string());
+        }
+        containerSize = std::filesystem::file_size(containerPath);
+
+        static_cast<void>(DumpContainer::parseHeader(readStoredData(0, DumpContainer::headerSize)));
+        DumpContainer::Header trailer{};
+        if (containerSize >= 2 * DumpContainer::headerSize)
+        {
+            try
+            {
+                trailer = DumpContainer::parseHeader(
+                    readStoredData(containerSize - DumpContainer::headerSize, DumpContainer::headerSize));
+            }
+            catch (const FormatException&)
+            {
+                // The container ends with frame data, so the index location stays zero
+            }
+        }
+        // The trailer directly follows the index, anything else means that the container has not been completed
+        if (trailer.indexOffset < DumpContainer::headerSize ||
+            trailer.indexOffset + trailer.indexSize != containerSize - DumpContainer::headerSize)
+        {
+            throw FormatException("Dump container is incomplete, the index has not been written");
+        }
+        regions = DumpContainer::parseIndex(readStoredData(trailer.indexOffset, trailer.indexSize));
+    }
+
+    const std::vector<RegionEntry>& DumpContainerReader::getRegions() const
+    {
+        return regions;
+    }
+
+    void DumpContainerReader::read(std::size_t regionIndex, uint64_t offset, std::span<uint8_t> buffer) const
+    {
+        const auto& region = regions.at(regionIndex);
+        if (offset > region.size || buffer.size() > region.size - offset)
+        {
+            throw std::out_of_range("Read exceeds the bounds of the region");
+        }
+
+        std::ranges::fill(buffer, 0);
+        auto rangeEnd = offset + buffer.size();
+        auto extentEnd = [](const PageExtent& extent)
+        { return (extent.firstPage + extent.numberOfPages) * DumpContainer::pageSize; };
+
+        for (auto extent = std::ranges::partition_point(region.extents,
+                                                        [offset, &extentEnd](const PageExtent& extent)
+                                                        { return extentEnd(extent) <= offset; });
+             extent != region.extents.end() && extent->firstPage * DumpContainer::pageSize < rangeEnd;
+             extent++)
+        {
+            if (extent->type == ExtentType::Zero)
+            {
+                continue;
+            }
+
+            auto pages = loadExtent(*extent);
+            auto extentStart = extent->firstPage * DumpContainer::pageSize;
+            auto copyStart = std::max(extentStart, offset);
+            auto copyEnd = std::min(extentEnd(*extent), rangeEnd);
+            std::copy(std::next(pages.begin(), static_cast<std::ptrdiff_t>(copyStart - extentStart)),
+                      std::next(pages.begin(), static_cast<std::ptrdiff_t>(copyEnd - extentStart)),
+                      std::next(buffer.begin(), static_cast<std::ptrdiff_t>(copyStart - offset)));
+        }
+    }
+
+    std::vector<uint8_t> DumpContainerReader::readRegion(std::size_t regionIndex) const
+    {
+        std::vector<uint8_t> content(regions.at(regionIndex).size);
+        read(regionIndex, 0, content);
+        return content;
+    }
+
+    std::vector<uint8_t> DumpContainerReader::readStoredData(uint64_t offset, uint64_t size) const
+    {
+        if (offset > containerSize || size > containerSize - offset)
+        {
+            throw FormatException("Dump container is truncated");
+        }
+        std::vector<uint8_t> data(size);
+
+        std::scoped_lock guard(containerLock);
+        container.clear();
+        container.seekg(static_cast<std::streamoff>(offset));
+        container.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(size));
+        if (!container)
+        {
+            throw FormatException("Dump container is truncated");
+        }
+
+        return data;
+    }
+
+    std::vector<uint8_t> DumpContainerReader::loadExtent(const PageExtent& extent) const
+    {
+        auto extentSize = static_cast<std::size_t>(extent.numberOfPages) * DumpContainer::pageSize;
+        auto storedData = readStoredData(extent.fileOffset, extent.storedSize);
+        if (extent.type == ExtentType::Raw)
+        {
+            if (storedData.size() != extentSize)
+            {
+                throw FormatException("Size of raw page extent does not match its number of pages");
+            }
+            return storedData;
+        }
+
+        std::vector<uint8_t> pages(extentSize);
+        auto decompressedSize = ZSTD_decompress(pages.data(), pages.size(), storedData.data(), storedData.size());
+        if (ZSTD_isError(decompressedSize) != 0)
+        {
+            throw FormatException(std::string("Unable to decompress page extent: ") +
+                                  ZSTD_getErrorName(decompressedSize));
+        }
+        if (decompressedSize != extentSize)
+        {
+            throw FormatException("Size of decompressed page extent does not match its number of pages");
+        }
+
+        return pages;
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "DumpContainerFormat.h"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <span>
+#include <vector>
+
+namespace InMemoryScanner
+{
+    /**
+     * Provides random access to the regions stored in a dump container. Only the frames overlapping the requested
+     * range are read and decompressed. Reading is thread safe.
+     */
+    class DumpContainerReader
+    {
+      public:
+        /**
+         * @throws DumpContainer::FormatException If the file is not a completely written dump container.
+         */
+        explicit DumpContainerReader(const std::filesystem::path& containerPath);
+
+        [[nodiscard]] const std::vector<DumpContainer::RegionEntry>& getRegions() const;
+
+        /**
+         * Fills the buffer with the region content starting at the given offset from the region base. Pages that
+         * were not mapped at the time of dumping read as zero.
+         */
+        void read(std::size_t regionIndex, uint64_t offset, std::span<uint8_t> buffer) const;
+
+        [[nodiscard]] std::vector<uint8_t> readRegion(std::size_t regionIndex) const;
+
+      private:
+        mutable std::ifstream container;
+        mutable std::mutex containerLock;
+        uint64_t containerSize{};
+        std::vector<DumpContainer::RegionEntry> regions;
+
+        [[nodiscard]] std::vector<uint8_t> readStoredData(uint64_t offset, uint64_t size) const;
+
+        [[nodiscard]] std::vector<uint8_t> loadExtent(const DumpContainer::PageExtent& extent) const;
+    };
+}
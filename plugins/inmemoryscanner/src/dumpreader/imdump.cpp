@@ -0,0 +1,142 @@
+#include "DumpContainerReader.h"
+#include <exception>
+#include <fmt/core.h>
+#include <fstream>
+#include <iostream>
+#include <tclap/CmdLine.h>
+
+using InMemoryScanner::DumpContainerReader;
+using InMemoryScanner::DumpContainer::ExtentType;
+using InMemoryScanner::DumpContainer::RegionEntry;
+
+namespace
+{
+    void listRegions(const DumpContainerReader& reader)
+    {
+        fmt::print("{:>6} {:>8} {:>18} {:>12} {:>6} {:>6} {:>12} {:>12} {} {}\n",
+                   "Index",
+                   "Pid",
+                   "StartAddress",
+                   "Size",
+                   "Rights",
+                   "Flags",
+                   "MappedPages",
+                   "StoredBytes",
+                   "Process",
+                   "Module");
+
+        const auto& regions = reader.getRegions();
+        for (std::size_t i = 0; i < regions.size(); i++)
+        {
+            const auto& region = regions[i];
+            uint64_t mappedPages = 0;
+            uint64_t storedBytes = 0;
+            for (const auto& extent : region.extents)
+            {
+                mappedPages += extent.numberOfPages;
+                storedBytes += extent.storedSize;
+            }
+            auto flags = fmt::format("{}{}{}",
+                                     region.isSharedMemory ? 'S' : '-',
+                                     region.isBeingDeleted ? 'D' : '-',
+                                     region.isProcessBaseImage ? 'B' : '-');
+
+            fmt::print("{:>6} {:>8} {:>#18x} {:>12} {:>6} {:>6} {:>12} {:>12} {} {}\n",
+                       i,
+                       region.pid,
+                       region.baseVA,
+                       region.size,
+                       region.protection,
+                       flags,
+                       mappedPages,
+                       storedBytes,
+                       region.processName,
+                       region.moduleName.empty() ? "private" : region.moduleName);
+        }
+    }
+
+    void extractRegion(const DumpContainerReader& reader,
+                       std::size_t regionIndex,
+                       uint64_t offset,
+                       uint64_t length,
+                       const std::string& outputFile)
+    {
+        // Regions are copied in bounded pieces, so extracting large regions does not require much memory
+        constexpr uint64_t maxReadSize = 16 * 1024 * 1024;
+
+        const auto& region = reader.getRegions().at(regionIndex);
+        if (offset > region.size)
+        {
+            throw std::out_of_range("Offset exceeds the size of the region");
+        }
+        if (length == 0 || length > region.size - offset)
+        {
+            length = region.size - offset;
+        }
+
+        std::ofstream outputFileStream;
+        if (outputFile != "-")
+        {
+            outputFileStream.exceptions(std::ios::failbit | std::ios::badbit);
+            outputFileStream.open(outputFile, std::ios::binary | std::ios::trunc);
+        }
+        auto& output = outputFile == "-" ? std::cout : outputFileStream;
+
+        std::vector<uint8_t> buffer;
+        for (uint64_t position = offset; position < offset + length; position += buffer.size())
+        {
+            buffer.resize(std::min(maxReadSize, offset + length - position));
+            reader.read(regionIndex, position, buffer);
+            output.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        }
+        output.flush();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        TCLAP::CmdLine cmd("Lists or extracts the memory regions of an InMemory scanner dump container. Without "
+                           "--region, the regions are listed.",
+                           ' ',
+                           "1.0");
+        TCLAP::UnlabeledValueArg<std::string> containerArgument(
+            "container", "Path to the dump container.", true, "", "path", cmd);
+        TCLAP::ValueArg<std::size_t> regionArgument(
+            "r", "region", "Index of the region to extract.", false, 0, "index", cmd);
+        TCLAP::ValueArg<uint64_t> offsetArgument(
+            "s", "offset", "Offset from the region start to extract from.", false, 0, "bytes", cmd);
+        TCLAP::ValueArg<uint64_t> lengthArgument(
+            "l", "length", "Number of bytes to extract, defaults to the rest of the region.", false, 0, "bytes", cmd);
+        TCLAP::ValueArg<std::string> outputArgument(
+            "o", "output", "File to write the extracted bytes to, '-' for stdout.", false, "-", "path", cmd);
+        cmd.parse(argc, argv);
+
+        DumpContainerReader reader(containerArgument.getValue());
+        if (regionArgument.isSet())
+        {
+            extractRegion(reader,
+                          regionArgument.getValue(),
+                          offsetArgument.getValue(),
+                          lengthArgument.getValue(),
+                          outputArgument.getValue());
+        }
+        else
+        {
+            listRegions(reader);
+        }
+    }
+    catch (const TCLAP::ArgException& e)
+    {
+        std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
+        return 1;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -28,6 +28,19 @@ namespace InMemoryScanner
         bool operator==(const Rule& rhs) const = default;
     };
 
+    inline std::vector<Rule> rebaseMatchPositions(const std::vector<Rule>& results, int64_t delta)
+    {
+        auto rebasedResults = results;
+        for (auto& rule : rebasedResults)
+        {
+            for (auto& match : rule.matches)
+            {
+                match.position += delta;
+            }
+        }
+        return rebasedResults;
+    }
+
     inline std::size_t bytesToNumberOfPages(std::size_t size)
     {
         return (size + VmiCore::PagingDefinitions::pageSizeInBytes - 1) / VmiCore::PagingDefinitions::pageSizeInBytes;
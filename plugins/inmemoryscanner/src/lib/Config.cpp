@@ -8,6 +8,27 @@ using VmiCore::Plugin::PluginInterface;
 
 namespace InMemoryScanner
 {
+    namespace
+    {
+        constexpr std::size_t bytesPerMiB = 1024 * 1024;
+        constexpr std::size_t defaultScanChunkSizeMiB = 0;
+        // Default level of the zstd command line tool, a good tradeoff between speed and ratio for memory pages
+        constexpr int defaultDumpCompressionLevel = 3;
+
+        ResultFormat parseResultFormat(const std::string& format)
+        {
+            if (format == "xml")
+            {
+                return ResultFormat::Xml;
+            }
+            if (format == "ndjson")
+            {
+                return ResultFormat::Ndjson;
+            }
+            throw ConfigException("Unknown result format " + format);
+        }
+    }
+
     Config::Config(const PluginInterface* pluginInterface)
         : logger(pluginInterface->newNamedLogger(INMEMORY_LOGGER_NAME))
     {
@@ -20,8 +41,15 @@ namespace InMemoryScanner
         signatureFile = rootNode["signature_file"].as<std::string>();
         outputPath = rootNode["output_path"].as<std::string>();
         dumpMemory = rootNode["dump_memory"].as<bool>(false);
+        dumpContainer = rootNode["dump_container"].as<bool>(false);
+        dumpCompressionLevel = rootNode["dump_compression_level"].as<int>(defaultDumpCompressionLevel);
+        dumpCompressionThreads = rootNode["dump_compression_threads"].as<std::size_t>(0);
         scanAllRegions = rootNode["scan_all_regions"].as<bool>(false);
+        deduplicateFrames = rootNode["deduplicate_frames"].as<bool>(false);
+        literalPrefilter = rootNode["literal_prefilter"].as<bool>(false);
         scanTimeout = rootNode["scan_timeout"].as<int>(10);
+        scanChunkSize = rootNode["scan_chunk_size"].as<std::size_t>(defaultScanChunkSizeMiB) * bytesPerMiB;
+        resultFormat = parseResultFormat(rootNode["result_format"].as<std::string>("xml"));
 
         auto ignoredProcessesVec =
             rootNode["ignored_processes"].as<std::vector<std::string>>(std::vector<std::string>());
@@ -64,6 +92,41 @@ namespace InMemoryScanner
         return dumpMemory;
     }
 
+    bool Config::isDumpContainerActivated() const
+    {
+        return dumpContainer;
+    }
+
+    int Config::getDumpCompressionLevel() const
+    {
+        return dumpCompressionLevel;
+    }
+
+    std::size_t Config::getDumpCompressionThreads() const
+    {
+        return dumpCompressionThreads;
+    }
+
+    bool Config::isFrameDeduplicationActivated() const
+    {
+        return deduplicateFrames;
+    }
+
+    std::size_t Config::getScanChunkSize() const
+    {
+        return scanChunkSize;
+    }
+
+    ResultFormat Config::getResultFormat() const
+    {
+        return resultFormat;
+    }
+
+    bool Config::isLiteralPrefilterActivated() const
+    {
+        return literalPrefilter;
+    }
+
     void Config::overrideDumpMemoryFlag(bool value)
     {
         dumpMemory = value;
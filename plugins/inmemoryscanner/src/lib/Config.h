@@ -15,6 +15,12 @@ namespace InMemoryScanner
         explicit ConfigException(const std::string& Message) : std::runtime_error(Message.c_str()) {};
     };
 
+    enum class ResultFormat
+    {
+        Xml,
+        Ndjson
+    };
+
     class IConfig
     {
       public:
@@ -34,6 +40,37 @@ namespace InMemoryScanner
 
         [[nodiscard]] virtual bool isDumpingMemoryActivated() const = 0;
 
+        /**
+         * Whether dumped regions are written to a single compressed container instead of one file per region.
+         */
+        [[nodiscard]] virtual bool isDumpContainerActivated() const = 0;
+
+        /**
+         * zstd compression level used for the dump container.
+         */
+        [[nodiscard]] virtual int getDumpCompressionLevel() const = 0;
+
+        /**
+         * Number of threads compressing dump container frames. Zero selects the number of available cores.
+         */
+        [[nodiscard]] virtual std::size_t getDumpCompressionThreads() const = 0;
+
+        [[nodiscard]] virtual bool isFrameDeduplicationActivated() const = 0;
+
+        /**
+         * Size in bytes above which memory regions are split into chunks that are scanned in parallel. Zero disables
+         * splitting, which is the default, as rule conditions are evaluated per chunk and may therefore behave
+         * differently than for the whole region.
+         */
+        [[nodiscard]] virtual std::size_t getScanChunkSize() const = 0;
+
+        [[nodiscard]] virtual ResultFormat getResultFormat() const = 0;
+
+        /**
+         * Whether memory is searched for the literals of the rules before it is scanned by yara.
+         */
+        [[nodiscard]] virtual bool isLiteralPrefilterActivated() const = 0;
+
         virtual void overrideDumpMemoryFlag(bool value) = 0;
 
       protected:
@@ -61,6 +98,20 @@ namespace InMemoryScanner
 
         [[nodiscard]] bool isDumpingMemoryActivated() const override;
 
+        [[nodiscard]] bool isDumpContainerActivated() const override;
+
+        [[nodiscard]] int getDumpCompressionLevel() const override;
+
+        [[nodiscard]] std::size_t getDumpCompressionThreads() const override;
+
+        [[nodiscard]] bool isFrameDeduplicationActivated() const override;
+
+        [[nodiscard]] std::size_t getScanChunkSize() const override;
+
+        [[nodiscard]] ResultFormat getResultFormat() const override;
+
+        [[nodiscard]] bool isLiteralPrefilterActivated() const override;
+
         void overrideDumpMemoryFlag(bool value) override;
 
       private:
@@ -69,7 +120,14 @@ namespace InMemoryScanner
         std::filesystem::path signatureFile;
         std::set<std::string> ignoredProcesses;
         bool dumpMemory{};
+        bool dumpContainer{};
         bool scanAllRegions{};
+        bool deduplicateFrames{};
+        bool literalPrefilter{};
         int scanTimeout;
+        int dumpCompressionLevel{};
+        std::size_t dumpCompressionThreads{};
+        std::size_t scanChunkSize{};
+        ResultFormat resultFormat{};
     };
 }
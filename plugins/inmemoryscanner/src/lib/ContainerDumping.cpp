@@ -0,0 +1,295 @@
+#include "ContainerDumping.h"
+#include "Common.h"
+#include "Filenames.h"
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <fmt/core.h>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+using InMemoryScanner::DumpContainer::ExtentType;
+using InMemoryScanner::DumpContainer::PageExtent;
+using InMemoryScanner::DumpContainer::RegionEntry;
+using VmiCore::MappedRegion;
+using VmiCore::MemoryRegion;
+using VmiCore::Plugin::PluginInterface;
+
+namespace InMemoryScanner
+{
+    namespace
+    {
+        // Frames are the unit of random access, larger frames compress slightly better but make small reads slower
+        constexpr std::size_t maxPagesPerFrame = 64;
+        // Compressed frames wait for preceding frames before they are stored, spare buffers keep the threads busy
+        constexpr std::size_t buffersPerThread = 2;
+        constexpr const char* containerName = "dumpedRegions.imdump";
+
+        std::size_t compressionThreadCount(const IConfig& configuration)
+        {
+            auto threadCount = configuration.getDumpCompressionThreads();
+            return threadCount != 0 ? threadCount : std::max(std::thread::hardware_concurrency(), 1U);
+        }
+
+        bool isZeroPage(std::span<const uint8_t> page)
+        {
+            // A page is all zeros if its first byte is zero and every byte equals its successor
+            return page.front() == 0 && std::memcmp(page.data(), page.data() + 1, page.size() - 1) == 0;
+        }
+    }
+
+    ContainerDumping::ContainerDumping(PluginInterface* pluginInterface, std::shared_ptr<IConfig> configuration)
+        : pluginInterface(pluginInterface),
+          logger(pluginInterface->newNamedLogger(INMEMORY_LOGGER_NAME)),
+          containerFilename((configuration->getOutputPath() / containerName).string()),
+          compressionLevel(configuration->getDumpCompressionLevel()),
+          maxBuffers(compressionThreadCount(*configuration) * buffersPerThread),
+          compressionPool(compressionThreadCount(*configuration), maxBuffers)
+    {
+        logger->bind({{VmiCore::WRITE_TO_FILE_TAG, LOG_FILENAME}});
+
+        static_cast<void>(append(DumpContainer::serializeHeader({DumpContainer::formatVersion, 0, 0})));
+    }
+
+    void ContainerDumping::dumpMemoryRegion(const std::string& processName,
+                                            pid_t pid,
+                                            const MemoryRegion& memoryRegionDescriptor,
+                                            std::span<const MappedRegion> mappedRegions)
+    {
+        RegionEntry regionEntry{static_cast<uint32_t>(pid),
+                                getNextRegionId(),
+                                memoryRegionDescriptor.base,
+                                memoryRegionDescriptor.size,
+                                memoryRegionDescriptor.isSharedMemory,
+                                memoryRegionDescriptor.isBeingDeleted,
+                                memoryRegionDescriptor.isProcessBaseImage,
+                                memoryRegionDescriptor.protection->toString(),
+                                processName,
+                                memoryRegionDescriptor.moduleName,
+                                {}};
+
+        logger->info("Dumping Memory region",
+                     {{"VA", fmt::format("{:x}", memoryRegionDescriptor.base)},
+                      {"Size", memoryRegionDescriptor.size},
+                      {"Process", processName},
+                      {"Pid", pid},
+                      {"Module", memoryRegionDescriptor.moduleName},
+                      {"RegionId", static_cast<uint64_t>(regionEntry.regionId)}});
+
+        // Frames are stored in page order, so compressed frames wait in this queue until all preceding ones are stored
+        std::deque<PendingFrame> pendingFrames;
+        try
+        {
+            for (const auto& mappedRegion : mappedRegions)
+            {
+                if (mappedRegion.guestBaseVA < memoryRegionDescriptor.base ||
+                    mappedRegion.guestBaseVA + mappedRegion.num_pages * DumpContainer::pageSize >
+                        memoryRegionDescriptor.base + memoryRegionDescriptor.size)
+                {
+                    throw std::invalid_argument(
+                        fmt::format("Mapping at {:x} lies outside of memory region at {:x}",
+                                    mappedRegion.guestBaseVA,
+                                    memoryRegionDescriptor.base));
+                }
+                auto mappedPages = mappedRegion.asSpan();
+                auto firstPage = (mappedRegion.guestBaseVA - memoryRegionDescriptor.base) / DumpContainer::pageSize;
+                auto page = [&mappedPages](std::size_t index)
+                { return mappedPages.subspan(index * DumpContainer::pageSize, DumpContainer::pageSize); };
+
+                // Split the mapped pages into runs of zero pages, stored without data, and frames of data pages
+                for (std::size_t runStart = 0; runStart < mappedRegion.num_pages;)
+                {
+                    auto isZeroRun = isZeroPage(page(runStart));
+                    auto maxRunLength = isZeroRun ? std::numeric_limits<uint32_t>::max() : maxPagesPerFrame;
+                    auto runEnd = runStart + 1;
+                    while (runEnd < mappedRegion.num_pages && runEnd - runStart < maxRunLength &&
+                           isZeroPage(page(runEnd)) == isZeroRun)
+                    {
+                        runEnd++;
+                    }
+
+                    PendingFrame frame{
+                        {firstPage + runStart, static_cast<uint32_t>(runEnd - runStart), ExtentType::Zero, 0, 0},
+                        {},
+                        nullptr,
+                        {}};
+                    if (!isZeroRun)
+                    {
+                        frame.pages = mappedPages.subspan(runStart * DumpContainer::pageSize,
+                                                          (runEnd - runStart) * DumpContainer::pageSize);
+                        // Only wait for a buffer of another region once all buffers of this region are released,
+                        // otherwise regions could wait for each other
+                        frame.buffer = acquireBuffer(false);
+                        while (!frame.buffer && !pendingFrames.empty())
+                        {
+                            regionEntry.extents.push_back(storeFrame(pendingFrames.front()));
+                            pendingFrames.pop_front();
+                            frame.buffer = acquireBuffer(false);
+                        }
+                        if (!frame.buffer)
+                        {
+                            frame.buffer = acquireBuffer(true);
+                        }
+                        submitFrame(frame);
+                    }
+                    pendingFrames.push_back(std::move(frame));
+
+                    runStart = runEnd;
+                }
+            }
+
+            while (!pendingFrames.empty())
+            {
+                regionEntry.extents.push_back(storeFrame(pendingFrames.front()));
+                pendingFrames.pop_front();
+            }
+        }
+        catch (...)
+        {
+            // Compression jobs still reference the buffers of the pending frames
+            for (auto& frame : pendingFrames)
+            {
+                if (frame.compressedSize.valid())
+                {
+                    frame.compressedSize.wait();
+                }
+                if (frame.buffer)
+                {
+                    releaseBuffer(std::move(frame.buffer));
+                }
+            }
+            throw;
+        }
+
+        std::scoped_lock guard(lock);
+        regions.push_back(std::move(regionEntry));
+    }
+
+    void ContainerDumping::submitFrame(PendingFrame& frame)
+    {
+        auto compressedSize = std::make_shared<std::promise<std::size_t>>();
+        frame.compressedSize = compressedSize->get_future();
+
+        compressionPool.submit(
+            [compressedSize,
+             context = frame.buffer->context.get(),
+             output = std::span(frame.buffer->data),
+             pages = frame.pages,
+             level = compressionLevel]()
+            {
+                auto result =
+                    ZSTD_compressCCtx(context, output.data(), output.size(), pages.data(), pages.size(), level);
+                if (ZSTD_isError(result) != 0)
+                {
+                    compressedSize->set_exception(std::make_exception_ptr(
+                        std::runtime_error(fmt::format("Unable to compress pages: {}", ZSTD_getErrorName(result)))));
+                    return;
+                }
+                compressedSize->set_value(result);
+            });
+    }
+
+    PageExtent ContainerDumping::storeFrame(PendingFrame& frame)
+    {
+        auto extent = frame.extent;
+        if (frame.pages.empty())
+        {
+            return extent;
+        }
+
+        auto compressedSize = frame.compressedSize.get();
+        auto storedData = frame.pages;
+        extent.type = ExtentType::Raw;
+        if (compressedSize < frame.pages.size())
+        {
+            storedData = std::span<const uint8_t>(frame.buffer->data).first(compressedSize);
+            extent.type = ExtentType::Zstd;
+        }
+        extent.fileOffset = append(storedData);
+        extent.storedSize = storedData.size();
+        releaseBuffer(std::move(frame.buffer));
+
+        return extent;
+    }
+
+    std::unique_ptr<ContainerDumping::CompressionBuffer> ContainerDumping::acquireBuffer(bool wait)
+    {
+        std::unique_lock guard(bufferPoolLock);
+        if (idleBuffers.empty() && createdBuffers == maxBuffers)
+        {
+            if (!wait)
+            {
+                return nullptr;
+            }
+            bufferReleased.wait(guard, [this]() { return !idleBuffers.empty(); });
+        }
+
+        if (!idleBuffers.empty())
+        {
+            auto buffer = std::move(idleBuffers.back());
+            idleBuffers.pop_back();
+            return buffer;
+        }
+
+        auto buffer = std::make_unique<CompressionBuffer>(
+            CompressionBuffer{{ZSTD_createCCtx(), &ZSTD_freeCCtx},
+                              std::vector<uint8_t>(ZSTD_compressBound(maxPagesPerFrame * DumpContainer::pageSize))});
+        if (!buffer->context)
+        {
+            throw std::runtime_error("Unable to create zstd compression context");
+        }
+        createdBuffers++;
+        return buffer;
+    }
+
+    void ContainerDumping::releaseBuffer(std::unique_ptr<CompressionBuffer> buffer)
+    {
+        {
+            std::scoped_lock guard(bufferPoolLock);
+            idleBuffers.push_back(std::move(buffer));
+        }
+        bufferReleased.notify_one();
+    }
+
+    void ContainerDumping::saveOutput()
+    {
+        std::scoped_lock guard(lock);
+        if (completed)
+        {
+            return;
+        }
+
+        auto index = DumpContainer::serializeIndex(regions);
+        auto indexOffset = containerSize;
+        pluginInterface->appendToFile(containerFilename, index);
+        containerSize += index.size();
+
+        // The trailer has to follow the index directly, so both are appended without releasing the lock
+        auto trailer = DumpContainer::serializeHeader({DumpContainer::formatVersion, indexOffset, index.size()});
+        pluginInterface->appendToFile(containerFilename, trailer);
+        containerSize += trailer.size();
+        completed = true;
+
+        logger->info("Dump container written",
+                     {{"DumpFile", containerFilename},
+                      {"Regions", static_cast<uint64_t>(regions.size())},
+                      {"Size", containerSize}});
+    }
+
+    uint32_t ContainerDumping::getNextRegionId()
+    {
+        std::scoped_lock guard(lock);
+        return regionCounter++;
+    }
+
+    uint64_t ContainerDumping::append(std::span<const uint8_t> data)
+    {
+        std::scoped_lock guard(lock);
+        auto offset = containerSize;
+        // Appending under the lock keeps the offsets in line with the order of the chunks in the file
+        pluginInterface->appendToFile(containerFilename, data);
+        containerSize += data.size();
+        return offset;
+    }
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Config.h"
+#include "Dumping.h"
+#include "ScanWorkerPool.h"
+#include <DumpContainerFormat.h>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+#include <vmicore/plugins/PluginInterface.h>
+#include <zstd.h>
+
+namespace InMemoryScanner
+{
+    /**
+     * Writes all dumped regions of a run into a single dump container, see DumpContainerFormat.h. The frames of a
+     * region are compressed in parallel by a dedicated pool of compression threads and appended in page order as soon
+     * as they are done, so the caller only waits for the last frames of a region. The container is appended to through
+     * the plugin interface. The index is only written by saveOutput, so the container is incomplete until then.
+     */
+    class ContainerDumping : public IDumping
+    {
+      public:
+        ContainerDumping(VmiCore::Plugin::PluginInterface* pluginInterface, std::shared_ptr<IConfig> configuration);
+
+        ~ContainerDumping() override = default;
+
+        void dumpMemoryRegion(const std::string& processName,
+                              pid_t pid,
+                              const VmiCore::MemoryRegion& memoryRegionDescriptor,
+                              std::span<const VmiCore::MappedRegion> mappedRegions) override;
+
+        void saveOutput() override;
+
+      private:
+        /**
+         * Compression state that is recycled between frames, avoiding allocations for every frame.
+         */
+        struct CompressionBuffer
+        {
+            std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> context;
+            std::vector<uint8_t> data;
+        };
+
+        struct PendingFrame
+        {
+            DumpContainer::PageExtent extent;
+            std::span<const uint8_t> pages;
+            std::unique_ptr<CompressionBuffer> buffer;
+            std::future<std::size_t> compressedSize;
+        };
+
+        VmiCore::Plugin::PluginInterface* pluginInterface;
+        std::unique_ptr<VmiCore::ILogger> logger;
+        std::string containerFilename;
+
+        std::mutex lock{};
+        uint64_t containerSize{};
+        bool completed = false;
+        std::vector<DumpContainer::RegionEntry> regions;
+        uint32_t regionCounter{};
+
+        int compressionLevel;
+        std::size_t maxBuffers;
+        std::size_t createdBuffers = 0;
+        std::mutex bufferPoolLock{};
+        std::condition_variable bufferReleased;
+        std::vector<std::unique_ptr<CompressionBuffer>> idleBuffers;
+        // Declared last so that all compression jobs are finished before any other member is destroyed
+        ScanWorkerPool compressionPool;
+
+        [[nodiscard]] uint32_t getNextRegionId();
+
+        /**
+         * Takes a buffer from the pool. The number of buffers is limited, which bounds the memory held by compressed
+         * frames that have not been stored yet. If the limit is reached, returns nullptr or waits for a buffer to be
+         * released, depending on the wait parameter.
+         */
+        [[nodiscard]] std::unique_ptr<CompressionBuffer> acquireBuffer(bool wait);
+
+        void releaseBuffer(std::unique_ptr<CompressionBuffer> buffer);
+
+        void submitFrame(PendingFrame& frame);
+
+        /**
+         * Waits for the compression of a frame to finish, appends the result to the container and returns the extent
+         * describing the stored data.
+         */
+        [[nodiscard]] DumpContainer::PageExtent storeFrame(PendingFrame& frame);
+
+        /**
+         * Appends data to the container and returns the offset it has been written to.
+         */
+        [[nodiscard]] uint64_t append(std::span<const uint8_t> data);
+    };
+}
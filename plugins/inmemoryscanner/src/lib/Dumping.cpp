@@ -4,7 +4,11 @@
 #include "Scanner.h"
 #include <algorithm>
 #include <fmt/core.h>
+#include <iterator>
+#include <sstream>
 
+using VmiCore::FileSegment;
+using VmiCore::MappedRegion;
 using VmiCore::MemoryRegion;
 using VmiCore::Plugin::PluginInterface;
 
@@ -22,7 +26,7 @@ namespace InMemoryScanner
     void Dumping::dumpMemoryRegion(const std::string& processName,
                                    pid_t pid,
                                    const MemoryRegion& memoryRegionDescriptor,
-                                   const std::vector<uint8_t>& data)
+                                   std::span<const MappedRegion> mappedRegions)
     {
         auto memoryRegionInformation =
             createMemoryRegionInformation(processName, pid, memoryRegionDescriptor, getNextRegionId());
@@ -36,7 +40,22 @@ namespace InMemoryScanner
                       {"Module", memoryRegionInformation->moduleName},
                       {"DumpFile", inMemDumpFileName}});
 
-        pluginInterface->writeToFile(dumpingPath / inMemDumpFileName, data);
+        // Unmapped parts of the region are collapsed into a single zero page between mapped chunks. Chunks are written
+        // directly from the mapping and the padding pages are left as holes in the dump file.
+        std::vector<FileSegment> segments;
+        segments.reserve(mappedRegions.size());
+        std::size_t fileSize = 0;
+        for (const auto& mappedRegion : mappedRegions)
+        {
+            if (!segments.empty())
+            {
+                fileSize += VmiCore::PagingDefinitions::pageSizeInBytes;
+            }
+            segments.push_back({fileSize, mappedRegion.asSpan()});
+            fileSize += mappedRegion.asSpan().size();
+        }
+
+        pluginInterface->writeSegmentsToFile(dumpingPath / inMemDumpFileName, segments, fileSize);
 
         auto inMemRegionInfo = memoryRegionInformation->toString();
 
@@ -84,9 +103,13 @@ namespace InMemoryScanner
         memoryRegionInfo.emplace_back(regionInfo);
     }
 
-    std::vector<std::string> Dumping::getAllMemoryRegionInformation()
+    void Dumping::saveOutput()
     {
-        std::scoped_lock guard(lock);
-        return memoryRegionInfo;
+        std::ostringstream vts;
+        {
+            std::scoped_lock guard(lock);
+            std::copy(memoryRegionInfo.begin(), memoryRegionInfo.end(), std::ostream_iterator<std::string>(vts, "\n"));
+        }
+        pluginInterface->writeToFile(configuration->getOutputPath() /= "MemoryRegionInformation.json", vts.str());
     }
 }
@@ -5,6 +5,7 @@
 #include <filesystem>
 #include <mutex>
 #include <random>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -121,9 +122,12 @@ namespace InMemoryScanner
         virtual void dumpMemoryRegion(const std::string& processName,
                                       pid_t pid,
                                       const VmiCore::MemoryRegion& memoryRegionDescriptor,
-                                      const std::vector<uint8_t>& data) = 0;
+                                      std::span<const VmiCore::MappedRegion> mappedRegions) = 0;
 
-        virtual std::vector<std::string> getAllMemoryRegionInformation() = 0;
+        /**
+         * Writes the information about all dumped regions. Called once after the final scan.
+         */
+        virtual void saveOutput() = 0;
 
       protected:
         IDumping() = default;
@@ -140,9 +144,9 @@ namespace InMemoryScanner
         void dumpMemoryRegion(const std::string& processName,
                               pid_t pid,
                               const VmiCore::MemoryRegion& memoryRegionDescriptor,
-                              const std::vector<uint8_t>& data) override;
+                              std::span<const VmiCore::MappedRegion> mappedRegions) override;
 
-        std::vector<std::string> getAllMemoryRegionInformation() override;
+        void saveOutput() override;
 
       private:
         VmiCore::Plugin::PluginInterface* pluginInterface;
@@ -4,6 +4,7 @@ namespace InMemoryScanner
 {
     constexpr const char* TEXT_RESULT_FILENAME = "inMemoryResults.txt";
     constexpr const char* XML_RESULT_FILENAME = "inMemoryResults.xml";
+    constexpr const char* NDJSON_RESULT_FILENAME = "inMemoryResults.ndjson";
 
     constexpr const char* LOG_FILENAME = "inMemory.txt";
 }
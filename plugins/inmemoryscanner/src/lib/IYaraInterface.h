@@ -26,6 +26,12 @@ namespace InMemoryScanner
 
         virtual std::vector<Rule> scanMemory(std::span<const VmiCore::MappedRegion> mappedRegions) = 0;
 
+        /**
+         * Upper bound for the number of bytes covered by a single string match of the loaded rules. Memory that is
+         * scanned in chunks has to overlap by at least this amount in order to not miss matches at chunk borders.
+         */
+        [[nodiscard]] virtual std::size_t getMaximumMatchLength() const = 0;
+
       protected:
         IYaraInterface() = default;
     };
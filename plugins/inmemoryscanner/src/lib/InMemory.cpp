@@ -9,6 +9,7 @@
 #include "InMemory.h"
 #include "Common.h"
 #include "Config.h"
+#include "ContainerDumping.h"
 #include "Dumping.h"
 #include "Filenames.h"
 #include "YaraInterface.h"
@@ -44,14 +45,29 @@ namespace InMemoryScanner
         {
             configuration->overrideDumpMemoryFlag(dumpMemoryArgument.getValue());
         }
-        auto yara = std::make_unique<YaraInterface>(configuration->getSignatureFile(), configuration->getScanTimeout());
-        auto dumping = std::make_unique<Dumping>(pluginInterface, configuration);
+        auto yara = std::make_unique<YaraInterface>(configuration->getSignatureFile(),
+                                                    configuration->getScanTimeout(),
+                                                    configuration->isLiteralPrefilterActivated());
+        if (configuration->isLiteralPrefilterActivated() && !yara->isLiteralPrefilterActive())
+        {
+            logger->warning("Literal prefilter is not applicable to the rules, scanning all memory");
+        }
+        std::unique_ptr<IDumping> dumping;
+        if (configuration->isDumpingMemoryActivated() && configuration->isDumpContainerActivated())
+        {
+            dumping = std::make_unique<ContainerDumping>(pluginInterface, configuration);
+        }
+        else
+        {
+            dumping = std::make_unique<Dumping>(pluginInterface, configuration);
+        }
         scanner = std::make_unique<Scanner>(pluginInterface, configuration, std::move(yara), std::move(dumping));
     }
 
     void InMemory::unload()
     {
         logger->info("Shutdown initiated");
+        scanner->waitForPendingScans();
         try
         {
             scanner->scanAllProcesses();
@@ -0,0 +1,192 @@
+#include "LiteralPrefilter.h"
+#include <algorithm>
+#include <bit>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define INMEMORYSCANNER_PREFILTER_SSSE3
+#include <immintrin.h>
+#endif
+
+namespace InMemoryScanner
+{
+    namespace
+    {
+        constexpr std::size_t vectorSize = 16;
+
+        uint8_t toLowerAscii(uint8_t character)
+        {
+            return character >= 'A' && character <= 'Z' ? static_cast<uint8_t>(character + ('a' - 'A')) : character;
+        }
+
+        uint8_t toUpperAscii(uint8_t character)
+        {
+            return character >= 'a' && character <= 'z' ? static_cast<uint8_t>(character - ('a' - 'A')) : character;
+        }
+
+        bool isLiteralAt(const LiteralPrefilter::Literal& literal, std::span<const uint8_t> data, std::size_t position)
+        {
+            if (literal.bytes.size() > data.size() - position)
+            {
+                return false;
+            }
+            auto candidate = data.subspan(position, literal.bytes.size());
+            if (literal.caseInsensitive)
+            {
+                return std::ranges::equal(literal.bytes,
+                                          candidate,
+                                          [](uint8_t lhs, uint8_t rhs)
+                                          { return toLowerAscii(lhs) == toLowerAscii(rhs); });
+            }
+            return std::ranges::equal(literal.bytes, candidate);
+        }
+    }
+
+    LiteralPrefilter::LiteralPrefilter(std::vector<Literal> literals) : literals(std::move(literals))
+    {
+        // Neighbouring literals tend to share prefixes, so sorted literals make buckets report fewer false candidates
+        std::ranges::sort(this->literals);
+        auto duplicates = std::ranges::unique(this->literals);
+        this->literals.erase(duplicates.begin(), duplicates.end());
+
+        for (std::size_t i = 0; i < this->literals.size(); i++)
+        {
+            auto bucket = i * numberOfBuckets / this->literals.size();
+            auto bucketBit = static_cast<uint8_t>(1U << bucket);
+            const auto& literal = this->literals[i];
+            buckets[bucket].push_back(i);
+
+            for (std::size_t position = 0; position < fingerprintLength; position++)
+            {
+                auto& masks = fingerprintMasks[position];
+                if (position >= literal.bytes.size())
+                {
+                    // Short literals accept any byte after their end
+                    std::ranges::for_each(masks.lowNibble, [bucketBit](uint8_t& mask) { mask |= bucketBit; });
+                    std::ranges::for_each(masks.highNibble, [bucketBit](uint8_t& mask) { mask |= bucketBit; });
+                    continue;
+                }
+
+                auto character = literal.bytes[position];
+                for (auto variant : {character,
+                                     literal.caseInsensitive ? toLowerAscii(character) : character,
+                                     literal.caseInsensitive ? toUpperAscii(character) : character})
+                {
+                    masks.lowNibble[variant & 0xF] |= bucketBit;
+                    masks.highNibble[variant >> 4] |= bucketBit;
+                }
+            }
+        }
+
+#ifdef INMEMORYSCANNER_PREFILTER_SSSE3
+        useSsse3 = __builtin_cpu_supports("ssse3");
+#else
+        useSsse3 = false;
+#endif
+    }
+
+    bool LiteralPrefilter::containsAnyLiteral(std::span<const uint8_t> data) const
+    {
+        std::size_t position = 0;
+        if (useSsse3 && containsAnyLiteralSsse3(data, position))
+        {
+            return true;
+        }
+
+        // The last candidates lack some of the following bytes, which are treated as matching any bucket
+        for (; position < data.size(); position++)
+        {
+            if (auto candidateBuckets = getCandidateBuckets(data, position);
+                candidateBuckets != 0 && isAnyLiteralAt(data, position, candidateBuckets))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    std::size_t LiteralPrefilter::getNumberOfLiterals() const
+    {
+        return literals.size();
+    }
+
+#ifdef INMEMORYSCANNER_PREFILTER_SSSE3
+    [[gnu::target("ssse3")]] bool LiteralPrefilter::containsAnyLiteralSsse3(std::span<const uint8_t> data,
+                                                                            std::size_t& position) const
+    {
+        const auto nibbleMask = _mm_set1_epi8(0xF);
+        alignas(vectorSize) std::array<uint8_t, vectorSize> candidateBuckets{};
+        for (; data.size() - position >= vectorSize + fingerprintLength - 1; position += vectorSize)
+        {
+            auto candidates = _mm_set1_epi8(static_cast<char>(0xFF));
+            for (std::size_t i = 0; i < fingerprintLength; i++)
+            {
+                auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data.data() + position + i));
+                auto lowNibbles = _mm_and_si128(bytes, nibbleMask);
+                auto highNibbles = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibbleMask);
+                // Loop invariant, the compiler keeps the masks in registers
+                auto lowNibbleMasks =
+                    _mm_load_si128(reinterpret_cast<const __m128i*>(fingerprintMasks[i].lowNibble.data()));
+                auto highNibbleMasks =
+                    _mm_load_si128(reinterpret_cast<const __m128i*>(fingerprintMasks[i].highNibble.data()));
+                candidates = _mm_and_si128(candidates,
+                                           _mm_and_si128(_mm_shuffle_epi8(lowNibbleMasks, lowNibbles),
+                                                         _mm_shuffle_epi8(highNibbleMasks, highNibbles)));
+            }
+
+            auto candidatePositions = static_cast<uint32_t>(
+                _mm_movemask_epi8(_mm_cmpeq_epi8(candidates, _mm_setzero_si128())) ^ 0xFFFF);
+            if (candidatePositions == 0)
+            {
+                continue;
+            }
+            _mm_store_si128(reinterpret_cast<__m128i*>(candidateBuckets.data()), candidates);
+            for (; candidatePositions != 0; candidatePositions &= candidatePositions - 1)
+            {
+                auto offset = static_cast<std::size_t>(std::countr_zero(candidatePositions));
+                if (isAnyLiteralAt(data, position + offset, candidateBuckets[offset]))
+                {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+#else
+    bool LiteralPrefilter::containsAnyLiteralSsse3([[maybe_unused]] std::span<const uint8_t> data,
+                                                   [[maybe_unused]] std::size_t& position) const
+    {
+        return false;
+    }
+#endif
+
+    uint8_t LiteralPrefilter::getCandidateBuckets(std::span<const uint8_t> data, std::size_t position) const
+    {
+        uint8_t candidateBuckets = 0xFF;
+        for (std::size_t i = 0; i < fingerprintLength && i < data.size() - position; i++)
+        {
+            auto character = data[position + i];
+            candidateBuckets &= static_cast<uint8_t>(fingerprintMasks[i].lowNibble[character & 0xF] &
+                                                     fingerprintMasks[i].highNibble[character >> 4]);
+        }
+        return candidateBuckets;
+    }
+
+    bool LiteralPrefilter::isAnyLiteralAt(std::span<const uint8_t> data,
+                                          std::size_t position,
+                                          uint8_t candidateBuckets) const
+    {
+        for (; candidateBuckets != 0; candidateBuckets &= static_cast<uint8_t>(candidateBuckets - 1))
+        {
+            for (auto literalIndex : buckets[static_cast<std::size_t>(std::countr_zero(candidateBuckets))])
+            {
+                if (isLiteralAt(literals[literalIndex], data, position))
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+}
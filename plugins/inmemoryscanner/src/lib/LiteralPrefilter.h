@@ -0,0 +1,62 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace InMemoryScanner
+{
+    /**
+     * Decides whether any of a set of literals occurs in a block of memory, following the Teddy algorithm of
+     * Hyperscan. The literals are distributed over eight buckets. For each of the first three bytes of a literal a
+     * table lookup per nibble yields the buckets whose literals may contain this byte at this position, so ANDing the
+     * lookups of three consecutive bytes yields the buckets of all literals that may start there. With SSSE3 the
+     * lookups are done for 16 positions at once. Only candidates are compared against the literals of their buckets.
+     */
+    class LiteralPrefilter
+    {
+      public:
+        struct Literal
+        {
+            std::vector<uint8_t> bytes;
+            /// ASCII letters match regardless of their case.
+            bool caseInsensitive;
+
+            auto operator<=>(const Literal& rhs) const = default;
+        };
+
+        explicit LiteralPrefilter(std::vector<Literal> literals);
+
+        [[nodiscard]] bool containsAnyLiteral(std::span<const uint8_t> data) const;
+
+        [[nodiscard]] std::size_t getNumberOfLiterals() const;
+
+      private:
+        static constexpr std::size_t numberOfBuckets = 8;
+        static constexpr std::size_t fingerprintLength = 3;
+
+        struct NibbleMasks
+        {
+            alignas(16) std::array<uint8_t, 16> lowNibble;
+            alignas(16) std::array<uint8_t, 16> highNibble;
+        };
+
+        std::vector<Literal> literals;
+        std::array<std::vector<std::size_t>, numberOfBuckets> buckets;
+        std::array<NibbleMasks, fingerprintLength> fingerprintMasks{};
+        bool useSsse3;
+
+        /**
+         * Checks all candidate positions that the vectorized lookup can be applied to and advances position past
+         * them.
+         */
+        [[nodiscard]] bool containsAnyLiteralSsse3(std::span<const uint8_t> data, std::size_t& position) const;
+
+        [[nodiscard]] uint8_t getCandidateBuckets(std::span<const uint8_t> data, std::size_t position) const;
+
+        [[nodiscard]] bool
+        isAnyLiteralAt(std::span<const uint8_t> data, std::size_t position, uint8_t candidateBuckets) const;
+    };
+}
@@ -0,0 +1,233 @@
+#include "ResultWriter.h"
+#include "Filenames.h"
+#include <fmt/format.h>
+#include <iterator>
+#include <span>
+
+namespace InMemoryScanner
+{
+    namespace
+    {
+        constexpr std::size_t maxBatchSize = 64 * 1024;
+        // Bounds the results that are lost on a crash when results only trickle in
+        constexpr auto maxBatchAge = std::chrono::seconds(1);
+
+        constexpr const char* xmlProlog = "<?xml version=\"1.0\"?>\n<root>\n";
+        constexpr const char* xmlEpilog = "</root>\n";
+
+        void appendXmlEscaped(std::string& output, const std::string& value)
+        {
+            for (auto character : value)
+            {
+                switch (character)
+                {
+                    case '&':
+                        output.append("&amp;");
+                        break;
+                    case '<':
+                        output.append("&lt;");
+                        break;
+                    case '>':
+                        output.append("&gt;");
+                        break;
+                    case '"':
+                        output.append("&quot;");
+                        break;
+                    case '\'':
+                        output.append("&apos;");
+                        break;
+                    default:
+                        output.push_back(character);
+                }
+            }
+        }
+
+        void appendJsonString(std::string& output, const std::string& value)
+        {
+            output.push_back('"');
+            for (auto character : value)
+            {
+                switch (character)
+                {
+                    case '"':
+                        output.append("\\\"");
+                        break;
+                    case '\\':
+                        output.append("\\\\");
+                        break;
+                    case '\n':
+                        output.append("\\n");
+                        break;
+                    case '\r':
+                        output.append("\\r");
+                        break;
+                    case '\t':
+                        output.append("\\t");
+                        break;
+                    default:
+                        if (static_cast<unsigned char>(character) < 0x20)
+                        {
+                            fmt::format_to(std::back_inserter(output), "\\u{:04x}", static_cast<int>(character));
+                        }
+                        else
+                        {
+                            output.push_back(character);
+                        }
+                }
+            }
+            output.push_back('"');
+        }
+
+        void serializeXml(std::string& output,
+                          const std::string& processName,
+                          int pid,
+                          uint64_t baseAddress,
+                          const std::vector<Rule>& results)
+        {
+            output.append("\t<process name=\"");
+            appendXmlEscaped(output, processName);
+            fmt::format_to(std::back_inserter(output), "\" pid=\"{}\">\n", pid);
+            for (const auto& result : results)
+            {
+                output.append("\t\t<rule namespace=\"");
+                appendXmlEscaped(output, result.ruleNamespace);
+                output.append("\" name=\"");
+                appendXmlEscaped(output, result.ruleName);
+                output.append("\">\n");
+                for (const auto& match : result.matches)
+                {
+                    output.append("\t\t\t<match name=\"");
+                    appendXmlEscaped(output, match.matchName);
+                    fmt::format_to(
+                        std::back_inserter(output), "\" position=\"{}\"/>\n", baseAddress + match.position);
+                }
+                output.append("\t\t</rule>\n");
+            }
+            output.append("\t</process>\n");
+        }
+
+        void serializeNdjson(std::string& output,
+                             const std::string& processName,
+                             int pid,
+                             uint64_t baseAddress,
+                             const std::vector<Rule>& results)
+        {
+            output.append("{\"process\":");
+            appendJsonString(output, processName);
+            fmt::format_to(std::back_inserter(output), ",\"pid\":{},\"baseAddress\":{},\"rules\":[", pid, baseAddress);
+            for (std::size_t i = 0; i < results.size(); i++)
+            {
+                output.append(i == 0 ? "{\"namespace\":" : ",{\"namespace\":");
+                appendJsonString(output, results[i].ruleNamespace);
+                output.append(",\"name\":");
+                appendJsonString(output, results[i].ruleName);
+                output.append(",\"matches\":[");
+                for (std::size_t j = 0; j < results[i].matches.size(); j++)
+                {
+                    output.append(j == 0 ? "{\"name\":" : ",{\"name\":");
+                    appendJsonString(output, results[i].matches[j].matchName);
+                    fmt::format_to(
+                        std::back_inserter(output), ",\"position\":{}}}", baseAddress + results[i].matches[j].position);
+                }
+                output.append("]}");
+            }
+            output.append("]}\n");
+        }
+    }
+
+    ResultWriter::ResultWriter(VmiCore::Plugin::PluginInterface* pluginInterface,
+                               const std::filesystem::path& resultFilename,
+                               ResultFormat format)
+        : pluginInterface(pluginInterface),
+          resultFilename(resultFilename.string()),
+          format(format),
+          lastWrite(std::chrono::steady_clock::now())
+    {
+    }
+
+    void ResultWriter::addResult(const std::string& processName,
+                                 int pid,
+                                 uint64_t baseAddress,
+                                 const std::vector<Rule>& results)
+    {
+        // Keeps its capacity, so serializing does not allocate once the thread has reported a few results
+        thread_local std::string serializedResult;
+        serializedResult.clear();
+        if (format == ResultFormat::Xml)
+        {
+            serializeXml(serializedResult, processName, pid, baseAddress, results);
+        }
+        else
+        {
+            serializeNdjson(serializedResult, processName, pid, baseAddress, results);
+        }
+
+        std::unique_lock batchGuard(batchLock);
+        if (finished)
+        {
+            return;
+        }
+        if (format == ResultFormat::Xml)
+        {
+            sortedResults.emplace(std::pair(pid, baseAddress), serializedResult);
+            return;
+        }
+        batch.append(serializedResult);
+        if (batch.size() >= maxBatchSize || std::chrono::steady_clock::now() - lastWrite >= maxBatchAge)
+        {
+            writeBatch(batchGuard);
+        }
+    }
+
+    void ResultWriter::flush()
+    {
+        std::unique_lock batchGuard(batchLock);
+        writeBatch(batchGuard);
+    }
+
+    void ResultWriter::finish()
+    {
+        std::unique_lock batchGuard(batchLock);
+        if (finished)
+        {
+            return;
+        }
+        finished = true;
+        if (format == ResultFormat::Xml)
+        {
+            std::string document(xmlProlog);
+            for (const auto& [key, serializedResult] : sortedResults)
+            {
+                document.append(serializedResult);
+            }
+            document.append(xmlEpilog);
+            sortedResults.clear();
+            batchGuard.unlock();
+
+            pluginInterface->writeToFile(resultFilename, document);
+            return;
+        }
+        writeBatch(batchGuard);
+    }
+
+    const char* ResultWriter::getResultFilename(ResultFormat format)
+    {
+        return format == ResultFormat::Xml ? XML_RESULT_FILENAME : NDJSON_RESULT_FILENAME;
+    }
+
+    void ResultWriter::writeBatch(std::unique_lock<std::mutex>& batchGuard)
+    {
+        std::scoped_lock fileGuard(fileLock);
+        std::swap(batch, writtenBatch);
+        lastWrite = std::chrono::steady_clock::now();
+        batchGuard.unlock();
+
+        if (!writtenBatch.empty())
+        {
+            pluginInterface->appendToFile(
+                resultFilename,
+                std::span(reinterpret_cast<const uint8_t*>(writtenBatch.data()), writtenBatch.size()));
+        }
+        writtenBatch.clear();
+    }
+}
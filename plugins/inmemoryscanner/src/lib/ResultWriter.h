@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Common.h"
+#include "Config.h"
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include <vmicore/plugins/PluginInterface.h>
+
+namespace InMemoryScanner
+{
+    /**
+     * Writes scan results through the plugin interface. Every result is serialized by the reporting thread into a
+     * thread local buffer without taking any lock, so only the serialized text is kept instead of a document tree.
+     * NDJSON results are added to a shared batch, which is appended to the result file once it is large enough or old
+     * enough. They are therefore written in the order in which they were reported, and everything up to the last
+     * appended batch survives a crash. XML results are kept sorted by pid and base address until finish writes the
+     * document, so the XML output has the same order in every run. The result file is only created by the first write.
+     */
+    class ResultWriter
+    {
+      public:
+        ResultWriter(VmiCore::Plugin::PluginInterface* pluginInterface,
+                     const std::filesystem::path& resultFilename,
+                     ResultFormat format);
+
+        void addResult(const std::string& processName, int pid, uint64_t baseAddress, const std::vector<Rule>& results);
+
+        /**
+         * Writes all NDJSON results that have been added so far. XML results are only written by finish.
+         */
+        void flush();
+
+        /**
+         * Writes the remaining results and completes the document. Results added afterwards are discarded.
+         */
+        void finish();
+
+        [[nodiscard]] static const char* getResultFilename(ResultFormat format);
+
+      private:
+        VmiCore::Plugin::PluginInterface* pluginInterface;
+        std::string resultFilename;
+        ResultFormat format;
+        std::string batch;
+        // Equal keys keep the order in which they were inserted
+        std::multimap<std::pair<int, uint64_t>, std::string> sortedResults;
+        bool finished = false;
+        std::chrono::steady_clock::time_point lastWrite;
+        std::mutex batchLock;
+        // Taken before batchLock is released, which keeps batches in order without holding batchLock during writes
+        std::mutex fileLock;
+        std::string writtenBatch;
+
+        void writeBatch(std::unique_lock<std::mutex>& batchGuard);
+    };
+}
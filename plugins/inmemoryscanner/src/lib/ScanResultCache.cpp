@@ -0,0 +1,61 @@
+#include "ScanResultCache.h"
+#include <array>
+#include <memory>
+#include <new>
+#include <xxhash.h>
+
+using VmiCore::addr_t;
+using VmiCore::MappedRegion;
+
+namespace InMemoryScanner
+{
+    ContentHash ScanResultCache::computeHash(addr_t regionBase, std::span<const MappedRegion> mappedRegions)
+    {
+        std::unique_ptr<XXH3_state_t, decltype(&XXH3_freeState)> state(XXH3_createState(), &XXH3_freeState);
+        if (!state)
+        {
+            throw std::bad_alloc();
+        }
+        XXH3_128bits_reset(state.get());
+
+        for (const auto& mappedRegion : mappedRegions)
+        {
+            auto content = mappedRegion.asSpan();
+            std::array<uint64_t, 2> layout{mappedRegion.guestBaseVA - regionBase, content.size()};
+            XXH3_128bits_update(state.get(), layout.data(), sizeof(layout));
+            XXH3_128bits_update(state.get(), content.data(), content.size());
+        }
+
+        auto digest = XXH3_128bits_digest(state.get());
+        return {.low = digest.low64, .high = digest.high64};
+    }
+
+    std::optional<std::vector<Rule>> ScanResultCache::find(const ContentHash& contentHash, addr_t regionBase) const
+    {
+        std::scoped_lock lock(cacheLock);
+        auto entry = entries.find(contentHash);
+        if (entry == entries.end())
+        {
+            return std::nullopt;
+        }
+        return rebaseMatchPositions(entry->second, static_cast<int64_t>(regionBase));
+    }
+
+    void ScanResultCache::insert(const ContentHash& contentHash, addr_t regionBase, const std::vector<Rule>& results)
+    {
+        auto relativeResults = rebaseMatchPositions(results, -static_cast<int64_t>(regionBase));
+
+        std::scoped_lock lock(cacheLock);
+        if (entries.size() >= maxEntries)
+        {
+            entries.clear();
+        }
+        entries.insert_or_assign(contentHash, std::move(relativeResults));
+    }
+
+    std::size_t ScanResultCache::size() const
+    {
+        std::scoped_lock lock(cacheLock);
+        return entries.size();
+    }
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Common.h"
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+#include <vmicore/types.h>
+#include <vmicore/vmi/MappedRegion.h>
+
+namespace InMemoryScanner
+{
+    struct ContentHash
+    {
+        uint64_t low;
+        uint64_t high;
+
+        bool operator==(const ContentHash& rhs) const = default;
+    };
+
+    /**
+     * Remembers scan results by the content of the scanned region, so that regions which are mapped into many
+     * processes, e.g. shared libraries, only have to be scanned once. Match positions are stored relative to the
+     * region base and are rebased on lookup, which allows reusing results for identical content at different
+     * addresses.
+     */
+    class ScanResultCache
+    {
+      public:
+        /**
+         * Computes a hash of the mapped memory including its layout relative to the region base, since unmapped
+         * holes separate the memory blocks handed to yara.
+         */
+        [[nodiscard]] static ContentHash computeHash(VmiCore::addr_t regionBase,
+                                                     std::span<const VmiCore::MappedRegion> mappedRegions);
+
+        [[nodiscard]] std::optional<std::vector<Rule>> find(const ContentHash& contentHash,
+                                                            VmiCore::addr_t regionBase) const;
+
+        void insert(const ContentHash& contentHash, VmiCore::addr_t regionBase, const std::vector<Rule>& results);
+
+        [[nodiscard]] std::size_t size() const;
+
+      private:
+        struct ContentHashHasher
+        {
+            std::size_t operator()(const ContentHash& contentHash) const
+            {
+                return contentHash.low;
+            }
+        };
+
+        // Protects against unbounded growth, the cache is cleared once exceeded
+        static constexpr std::size_t maxEntries = 0x10000;
+
+        mutable std::mutex cacheLock;
+        std::unordered_map<ContentHash, std::vector<Rule>, ContentHashHasher> entries;
+    };
+}
@@ -0,0 +1,76 @@
+#include "ScanWorkerPool.h"
+#include <stdexcept>
+
+namespace InMemoryScanner
+{
+    ScanWorkerPool::ScanWorkerPool(std::size_t workerCount, std::size_t capacity) : capacity(capacity)
+    {
+        if (workerCount == 0 || capacity == 0)
+        {
+            throw std::invalid_argument("Scan worker pool needs at least one worker and a non-zero capacity");
+        }
+
+        workers.reserve(workerCount);
+        for (std::size_t i = 0; i < workerCount; i++)
+        {
+            workers.emplace_back(&ScanWorkerPool::processJobs, this);
+        }
+    }
+
+    ScanWorkerPool::~ScanWorkerPool()
+    {
+        {
+            std::scoped_lock lock(queueLock);
+            stopping = true;
+        }
+        queueNotEmpty.notify_all();
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    void ScanWorkerPool::submit(std::function<void()> job)
+    {
+        {
+            std::unique_lock lock(queueLock);
+            queueNotFull.wait(lock, [this]() { return queue.size() < capacity; });
+            queue.push_back(std::move(job));
+        }
+        queueNotEmpty.notify_one();
+    }
+
+    void ScanWorkerPool::waitForCompletion()
+    {
+        std::unique_lock lock(queueLock);
+        allJobsDone.wait(lock, [this]() { return queue.empty() && runningJobs == 0; });
+    }
+
+    void ScanWorkerPool::processJobs()
+    {
+        while (true)
+        {
+            std::function<void()> job;
+            {
+                std::unique_lock lock(queueLock);
+                queueNotEmpty.wait(lock, [this]() { return stopping || !queue.empty(); });
+                if (queue.empty())
+                {
+                    return;
+                }
+                job = std::move(queue.front());
+                queue.pop_front();
+                runningJobs++;
+            }
+            queueNotFull.notify_one();
+
+            job();
+
+            {
+                std::scoped_lock lock(queueLock);
+                runningJobs--;
+            }
+            allJobsDone.notify_all();
+        }
+    }
+}
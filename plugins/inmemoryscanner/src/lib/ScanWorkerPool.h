@@ -0,0 +1,48 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace InMemoryScanner
+{
+    /**
+     * Fixed set of worker threads processing scan jobs from a bounded queue. Submitting blocks while the queue is
+     * full, which limits the amount of memory held by pending jobs. Jobs are expected to handle their own errors.
+     */
+    class ScanWorkerPool
+    {
+      public:
+        ScanWorkerPool(std::size_t workerCount, std::size_t capacity);
+
+        ~ScanWorkerPool();
+
+        ScanWorkerPool(const ScanWorkerPool&) = delete;
+
+        ScanWorkerPool& operator=(const ScanWorkerPool&) = delete;
+
+        void submit(std::function<void()> job);
+
+        /**
+         * Blocks until all submitted jobs have been processed.
+         */
+        void waitForCompletion();
+
+      private:
+        std::size_t capacity;
+        std::mutex queueLock;
+        std::condition_variable queueNotEmpty;
+        std::condition_variable queueNotFull;
+        std::condition_variable allJobsDone;
+        std::deque<std::function<void()>> queue;
+        std::size_t runningJobs = 0;
+        bool stopping = false;
+        std::vector<std::thread> workers;
+
+        void processJobs();
+    };
+}
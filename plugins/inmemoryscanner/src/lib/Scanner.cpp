@@ -3,7 +3,10 @@
 #include "Filenames.h"
 #include <algorithm>
 #include <fmt/core.h>
-#include <future>
+#include <iterator>
+#include <map>
+#include <tuple>
+#include <thread>
 #include <vmicore/callback.h>
 #include <vmicore/os/PagingDefinitions.h>
 
@@ -17,6 +20,55 @@ using VmiCore::Plugin::PluginInterface;
 
 namespace InMemoryScanner
 {
+    namespace
+    {
+        // Number of terminated processes whose snapshots may wait for a scan worker before termination blocks
+        constexpr std::size_t terminationScanQueueCapacity = 16;
+
+        std::size_t scanWorkerCount()
+        {
+            return std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, YR_MAX_THREADS);
+        }
+
+        // Combines the results of overlapping chunks independently of the order in which the chunks were scanned.
+        // Matches inside of an overlap are found by both adjacent chunks and are therefore deduplicated.
+        std::vector<Rule> mergeChunkResults(std::vector<Rule> chunkResults)
+        {
+            std::map<std::pair<std::string, std::string>, std::vector<Match>> matchesByRule;
+            for (auto& rule : chunkResults)
+            {
+                auto& matches = matchesByRule[{rule.ruleNamespace, rule.ruleName}];
+                std::ranges::move(rule.matches, std::back_inserter(matches));
+            }
+
+            std::vector<Rule> results;
+            results.reserve(matchesByRule.size());
+            for (auto& [ruleKey, matches] : matchesByRule)
+            {
+                std::ranges::sort(matches,
+                                  {},
+                                  [](const Match& match) { return std::tie(match.position, match.matchName); });
+                auto duplicates = std::ranges::unique(matches);
+                matches.erase(duplicates.begin(), duplicates.end());
+                const auto& [ruleNamespace, ruleName] = ruleKey;
+                results.push_back(
+                    {.ruleName = ruleName, .ruleNamespace = ruleNamespace, .matches = std::move(matches)});
+            }
+            return results;
+        }
+
+        // Owners of shared frames map them at different addresses, but at the same offsets relative to their regions
+        std::vector<MappedRegion> rebaseMappedRegions(std::span<const MappedRegion> mappedRegions, int64_t delta)
+        {
+            std::vector<MappedRegion> rebasedRegions(mappedRegions.begin(), mappedRegions.end());
+            for (auto& mappedRegion : rebasedRegions)
+            {
+                mappedRegion.guestBaseVA += delta;
+            }
+            return rebasedRegions;
+        }
+    }
+
     Scanner::Scanner(PluginInterface* pluginInterface,
                      std::shared_ptr<IConfig> configuration,
                      std::unique_ptr<IYaraInterface> yaraInterface,
@@ -24,15 +76,21 @@ namespace InMemoryScanner
         : pluginInterface(pluginInterface),
           configuration(std::move(configuration)),
           yaraInterface(std::move(yaraInterface)),
+          resultWriter(pluginInterface,
+                       this->configuration->getOutputPath() /
+                           ResultWriter::getResultFilename(this->configuration->getResultFormat()),
+                       this->configuration->getResultFormat()),
           dumping(std::move(dumping)),
           logger(pluginInterface->newNamedLogger(INMEMORY_LOGGER_NAME)),
-          inMemResultsLogger(pluginInterface->newNamedLogger(INMEMORY_LOGGER_NAME))
+          inMemResultsLogger(pluginInterface->newNamedLogger(INMEMORY_LOGGER_NAME)),
+          regionScanPool(scanWorkerCount()),
+          scanWorkerPool(scanWorkerCount(), terminationScanQueueCapacity)
     {
         logger->bind({{VmiCore::WRITE_TO_FILE_TAG, LOG_FILENAME}});
         inMemResultsLogger->bind(
             {{VmiCore::WRITE_TO_FILE_TAG, (this->configuration->getOutputPath() / TEXT_RESULT_FILENAME).string()}});
 
-        pluginInterface->registerProcessTerminationEvent(VMICORE_SETUP_MEMBER_CALLBACK(scanProcess));
+        pluginInterface->registerProcessTerminationEvent(VMICORE_SETUP_MEMBER_CALLBACK(scanTerminatedProcess));
     }
 
     std::unique_ptr<std::string> Scanner::getFilenameFromPath(const std::string& path)
@@ -46,52 +104,33 @@ namespace InMemoryScanner
         return filename;
     }
 
-    bool Scanner::shouldRegionBeScanned(const MemoryRegion& memoryRegionDescriptor)
+    bool Scanner::shouldProcessBeScanned(const ActiveProcessInformation& processInformation)
     {
-        if (configuration->isScanAllRegionsActivated())
+        if (processInformation.pid == 0)
         {
-            return true;
+            throw std::invalid_argument("Scanning pid 0 should never happen");
         }
-        if (memoryRegionDescriptor.isSharedMemory && !memoryRegionDescriptor.isProcessBaseImage)
+        if (configuration->isProcessIgnored(*processInformation.fullName))
         {
-            logger->info("Skipping: Is shared memory and not the process base image.");
+            logger->info("Process is ignored due to process name",
+                         {{"Pid", processInformation.pid}, {"Name", *processInformation.fullName}});
             return false;
         }
         return true;
     }
 
-    std::vector<uint8_t> Scanner::constructPaddedMemoryRegion(std::span<const MappedRegion> regions)
+    bool Scanner::shouldRegionBeScanned(const MemoryRegion& memoryRegionDescriptor)
     {
-        std::vector<uint8_t> result;
-
-        if (regions.empty())
-        {
-            return result;
-        }
-
-        std::size_t regionSize = 0;
-        for (const auto& region : regions)
+        if (configuration->isScanAllRegionsActivated())
         {
-            regionSize += region.asSpan().size();
-            regionSize += pageSizeInBytes;
+            return true;
         }
-        // last region should not have succeeding padding page
-        regionSize -= pageSizeInBytes;
-
-        result.reserve(regionSize);
-        // copy first region
-        auto frontRegionSpan = regions.front().asSpan();
-        std::ranges::copy(frontRegionSpan.begin(), frontRegionSpan.end(), std::back_inserter(result));
-
-        // copy the rest of the regions with a padding page in between each chunk
-        for (std::size_t i = 1; i < regions.size(); i++)
+        if (memoryRegionDescriptor.isSharedMemory && !memoryRegionDescriptor.isProcessBaseImage)
         {
-            result.insert(result.end(), pageSizeInBytes, 0);
-            auto regionSpan = regions[i].asSpan();
-            std::ranges::copy(regionSpan.begin(), regionSpan.end(), std::back_inserter(result));
+            logger->info("Skipping: Is shared memory and not the process base image.");
+            return false;
         }
-
-        return result;
+        return true;
     }
 
     void Scanner::scanMemoryRegion(pid_t pid,
@@ -119,104 +158,489 @@ namespace InMemoryScanner
             return;
         }
 
+        scanMappedRegions(pid, processName, memoryRegionDescriptor, mappedRegions);
+    }
+
+    void Scanner::scanMemoryRegionOfProcess(const ActiveProcessInformation& processInformation,
+                                            const MemoryRegion& memoryRegionDescriptor)
+    {
+        try
+        {
+            scanMemoryRegion(processInformation.pid,
+                             processInformation.processUserDtb,
+                             *processInformation.fullName,
+                             memoryRegionDescriptor);
+        }
+        catch (const YaraTimeoutException&)
+        {
+            logger->warning("Scan timeout reached",
+                            {{"Process", *processInformation.fullName},
+                             {"BaseVA", memoryRegionDescriptor.base},
+                             {"Size", memoryRegionDescriptor.size}});
+        }
+        catch (const std::exception& exc)
+        {
+            logger->error("Error scanning memory region of process",
+                          {{"Name", *processInformation.fullName}, {"Exception", exc.what()}});
+            pluginInterface->sendErrorEvent(exc.what());
+        }
+    }
+
+    void Scanner::scanMappedRegions(pid_t pid,
+                                    const std::string& processName,
+                                    const MemoryRegion& memoryRegionDescriptor,
+                                    std::span<const MappedRegion> mappedRegions)
+    {
         if (configuration->isDumpingMemoryActivated())
         {
             logger->debug("Start dumpVadRegionToFile", {{"Size", memoryRegionDescriptor.size}});
 
-            auto paddedRegion = constructPaddedMemoryRegion(mappedRegions);
+            dumping->dumpMemoryRegion(processName, pid, memoryRegionDescriptor, mappedRegions);
+        }
+
+        reportResults(processName,
+                      pid,
+                      memoryRegionDescriptor.base,
+                      matchMappedRegions(memoryRegionDescriptor, mappedRegions));
+    }
 
-            dumping->dumpMemoryRegion(processName, pid, memoryRegionDescriptor, paddedRegion);
+    std::vector<Rule> Scanner::matchMappedRegions(const MemoryRegion& memoryRegionDescriptor,
+                                                  std::span<const MappedRegion> mappedRegions)
+    {
+        std::optional<ContentHash> contentHash;
+        std::optional<std::vector<Rule>> results;
+        // Shared memory mostly consists of images of shared libraries, which are identical in many processes
+        if (memoryRegionDescriptor.isSharedMemory)
+        {
+            contentHash = ScanResultCache::computeHash(memoryRegionDescriptor.base, mappedRegions);
+            results = scanResultCache.find(*contentHash, memoryRegionDescriptor.base);
+        }
+
+        if (results)
+        {
+            logger->debug("Reusing scan result of identical memory region", {{"Size", memoryRegionDescriptor.size}});
+            return *results;
         }
 
         logger->debug("Start scanMemory", {{"Size", memoryRegionDescriptor.size}});
+        results = scanWithYara(mappedRegions);
+        logger->debug("End scanMemory");
 
+        if (contentHash)
+        {
+            scanResultCache.insert(*contentHash, memoryRegionDescriptor.base, *results);
+        }
+        return *results;
+    }
+
+    std::vector<Rule> Scanner::scanWithYara(std::span<const MappedRegion> mappedRegions)
+    {
         // The semaphore protects the yara rules from being accessed more than YR_MAX_THREADS (32 atm.) times in
         // parallel.
         semaphore.acquire();
-        auto results = yaraInterface->scanMemory(mappedRegions);
-        semaphore.release();
+        try
+        {
+            auto results = yaraInterface->scanMemory(mappedRegions);
+            semaphore.release();
+            return results;
+        }
+        catch (...)
+        {
+            semaphore.release();
+            throw;
+        }
+    }
 
-        logger->debug("End scanMemory");
+    void Scanner::addRegionScanJobs(std::vector<WorkStealingPool::Job>& scanJobs,
+                                    const std::shared_ptr<const ActiveProcessInformation>& processInformation,
+                                    const MemoryRegion& memoryRegionDescriptor)
+    {
+        auto chunkSize = bytesToNumberOfPages(configuration->getScanChunkSize()) * pageSizeInBytes;
+        // Dumps always contain whole regions, so regions are only split if dumping is disabled
+        if (chunkSize == 0 || memoryRegionDescriptor.size <= chunkSize || configuration->isDumpingMemoryActivated())
+        {
+            scanJobs.push_back({.cost = memoryRegionDescriptor.size,
+                                .work = [this, processInformation, &memoryRegionDescriptor]()
+                                { scanMemoryRegionOfProcess(*processInformation, memoryRegionDescriptor); }});
+            return;
+        }
 
-        if (!results.empty())
+        if (!shouldRegionBeScanned(memoryRegionDescriptor))
         {
-            for (const auto& result : results)
+            return;
+        }
+
+        // Each chunk extends into its successor, so that matches crossing a chunk border are found as a whole
+        auto overlap = bytesToNumberOfPages(yaraInterface->getMaximumMatchLength()) * pageSizeInBytes;
+        auto regionScan = std::make_shared<ChunkedRegionScan>();
+        regionScan->pendingChunks = (memoryRegionDescriptor.size + chunkSize - 1) / chunkSize;
+        for (std::size_t offset = 0; offset < memoryRegionDescriptor.size; offset += chunkSize)
+        {
+            auto chunkLength = std::min(chunkSize + overlap, memoryRegionDescriptor.size - offset);
+            scanJobs.push_back({.cost = chunkLength,
+                                .work =
+                                    [this,
+                                     processInformation,
+                                     &memoryRegionDescriptor,
+                                     chunkBase = memoryRegionDescriptor.base + offset,
+                                     chunkLength,
+                                     regionScan]()
+                                {
+                                    scanMemoryRegionChunk(*processInformation,
+                                                          memoryRegionDescriptor,
+                                                          chunkBase,
+                                                          chunkLength,
+                                                          *regionScan);
+                                }});
+        }
+    }
+
+    void Scanner::scanMemoryRegionChunk(const ActiveProcessInformation& processInformation,
+                                        const MemoryRegion& memoryRegionDescriptor,
+                                        addr_t chunkBase,
+                                        std::size_t chunkSize,
+                                        ChunkedRegionScan& regionScan)
+    {
+        logger->info("Scanning Memory region chunk",
+                     {{"VA", fmt::format("{:x}", chunkBase)},
+                      {"Size", chunkSize},
+                      {"Module", memoryRegionDescriptor.moduleName}});
+
+        std::vector<Rule> chunkResults;
+        try
+        {
+            auto memoryMapping = pluginInterface->mapProcessMemoryRegion(
+                chunkBase, processInformation.processUserDtb, bytesToNumberOfPages(chunkSize));
+            auto mappedRegions = memoryMapping->getMappedRegions();
+            if (!mappedRegions.empty())
             {
-                pluginInterface->sendInMemDetectionEvent(result.ruleName);
+                chunkResults = scanWithYara(mappedRegions);
             }
-            outputXml.addResult(processName, pid, memoryRegionDescriptor.base, results);
-            logInMemoryResultToTextFile(processName, pid, memoryRegionDescriptor.base, results);
+        }
+        catch (const YaraTimeoutException&)
+        {
+            logger->warning("Scan timeout reached",
+                            {{"Process", *processInformation.fullName},
+                             {"BaseVA", chunkBase},
+                             {"Size", chunkSize}});
+        }
+        catch (const std::exception& exc)
+        {
+            logger->error("Error scanning memory region of process",
+                          {{"Name", *processInformation.fullName}, {"Exception", exc.what()}});
+            pluginInterface->sendErrorEvent(exc.what());
+        }
+
+        std::unique_lock lock(regionScan.lock);
+        std::ranges::move(chunkResults, std::back_inserter(regionScan.results));
+        // The last chunk to finish reports the results of the whole region
+        if (--regionScan.pendingChunks > 0)
+        {
+            return;
+        }
+        auto results = mergeChunkResults(std::move(regionScan.results));
+        lock.unlock();
+
+        // Chunk jobs run on the worker pool, which must not see exceptions
+        try
+        {
+            reportResults(*processInformation.fullName, processInformation.pid, memoryRegionDescriptor.base, results);
+        }
+        catch (const std::exception& exc)
+        {
+            logger->error("Error reporting results of memory region",
+                          {{"Name", *processInformation.fullName}, {"Exception", exc.what()}});
+            pluginInterface->sendErrorEvent(exc.what());
         }
     }
 
+    void Scanner::reportResults(const std::string& processName,
+                                pid_t pid,
+                                addr_t baseAddress,
+                                const std::vector<Rule>& results)
+    {
+        if (results.empty())
+        {
+            return;
+        }
+
+        for (const auto& result : results)
+        {
+            pluginInterface->sendInMemDetectionEvent(result.ruleName);
+        }
+        resultWriter.addResult(processName, pid, baseAddress, results);
+        logInMemoryResultToTextFile(processName, pid, baseAddress, results);
+    }
+
     void Scanner::scanProcess(std::shared_ptr<const ActiveProcessInformation> processInformation)
     {
-        if (processInformation->pid == 0)
+        if (!shouldProcessBeScanned(*processInformation))
         {
-            throw std::invalid_argument("Scanning pid 0 should never happen");
+            return;
         }
-        if (configuration->isProcessIgnored(*processInformation->fullName))
+
+        logger->info("Scanning process", {{"Pid", processInformation->pid}, {"Name", *processInformation->fullName}});
+        try
         {
-            logger->info("Process is ignored due to process name",
-                         {{"Pid", processInformation->pid}, {"Name", *processInformation->fullName}});
+            auto memoryRegions = processInformation->memoryRegionExtractor->extractAllMemoryRegions();
+
+            for (const auto& memoryRegionDescriptor : *memoryRegions)
+            {
+                scanMemoryRegionOfProcess(*processInformation, memoryRegionDescriptor);
+            }
         }
-        else
+        catch (const std::exception& exc)
         {
-            logger->info("Scanning process",
-                         {{"Pid", processInformation->pid}, {"Name", *processInformation->fullName}});
+            logger->error("Error scanning process",
+                          {{"Name", *processInformation->fullName}, {"Exception", exc.what()}});
+            pluginInterface->sendErrorEvent(exc.what());
+        }
+        logger->info("Done scanning process",
+                     {{"Pid", processInformation->pid}, {"Name", *processInformation->fullName}});
+    }
+
+    void Scanner::scanTerminatedProcess(std::shared_ptr<const ActiveProcessInformation> processInformation)
+    {
+        if (!shouldProcessBeScanned(*processInformation))
+        {
+            return;
+        }
+
+        logger->info("Copying memory of terminating process",
+                     {{"Pid", processInformation->pid}, {"Name", *processInformation->fullName}});
+        std::shared_ptr<const ProcessSnapshot> processSnapshot;
+        try
+        {
+            processSnapshot = std::make_shared<const ProcessSnapshot>(ProcessSnapshot{
+                .pid = processInformation->pid,
+                .processName = *processInformation->fullName,
+                .memorySnapshot = pluginInterface->snapshotProcessMemory(
+                    *processInformation,
+                    [this](const MemoryRegion& memoryRegionDescriptor)
+                    { return shouldRegionBeScanned(memoryRegionDescriptor); })});
+        }
+        catch (const std::length_error& exc)
+        {
+            // Nothing has been copied yet, scan the process in place while it is still paused in the callback
+            logger->warning("Process memory does not fit into snapshot memory, scanning synchronously",
+                            {{"Pid", processInformation->pid}, {"Exception", exc.what()}});
+            scanProcess(processInformation);
+            return;
+        }
+        catch (const std::exception& exc)
+        {
+            logger->error("Error scanning process",
+                          {{"Name", *processInformation->fullName}, {"Exception", exc.what()}});
+            pluginInterface->sendErrorEvent(exc.what());
+            return;
+        }
+
+        scanWorkerPool.submit([this, processSnapshot]() { scanProcessSnapshot(*processSnapshot); });
+    }
+
+    void Scanner::waitForPendingScans()
+    {
+        scanWorkerPool.waitForCompletion();
+        resultWriter.flush();
+    }
+
+    void Scanner::scanProcessSnapshot(const ProcessSnapshot& processSnapshot)
+    {
+        logger->info("Scanning process", {{"Pid", processSnapshot.pid}, {"Name", processSnapshot.processName}});
+
+        for (const auto& regionSnapshot : processSnapshot.memorySnapshot->getRegions())
+        {
+            const auto& memoryRegionDescriptor = regionSnapshot.memoryRegionDescriptor;
+            logger->info("Scanning Memory region",
+                         {{"VA", fmt::format("{:x}", memoryRegionDescriptor.base)},
+                          {"Size", memoryRegionDescriptor.size},
+                          {"Module", memoryRegionDescriptor.moduleName}});
             try
             {
-                auto memoryRegions = processInformation->memoryRegionExtractor->extractAllMemoryRegions();
+                scanMappedRegions(processSnapshot.pid,
+                                  processSnapshot.processName,
+                                  memoryRegionDescriptor,
+                                  regionSnapshot.mappedRegions);
+            }
+            catch (const YaraTimeoutException&)
+            {
+                logger->warning("Scan timeout reached",
+                                {{"Process", processSnapshot.processName},
+                                 {"BaseVA", memoryRegionDescriptor.base},
+                                 {"Size", memoryRegionDescriptor.size}});
+            }
+            catch (const std::exception& exc)
+            {
+                logger->error("Error scanning memory region of process",
+                              {{"Name", processSnapshot.processName}, {"Exception", exc.what()}});
+                pluginInterface->sendErrorEvent(exc.what());
+            }
+        }
 
+        logger->info("Done scanning process", {{"Pid", processSnapshot.pid}, {"Name", processSnapshot.processName}});
+    }
+
+    void Scanner::scanAllProcesses()
+    {
+        if (configuration->isFrameDeduplicationActivated())
+        {
+            scanAllProcessesByFrames();
+            return;
+        }
+
+        auto processes = pluginInterface->getRunningProcesses();
+        // Keeps the region descriptors referenced by the scan jobs alive
+        std::vector<std::unique_ptr<std::vector<MemoryRegion>>> memoryRegionsOfAllProcesses;
+        std::vector<WorkStealingPool::Job> scanJobs;
+        for (const auto& process : *processes)
+        {
+            if (process->pid == 0 || !shouldProcessBeScanned(*process))
+            {
+                continue;
+            }
+
+            logger->info("Scanning process", {{"Pid", process->pid}, {"Name", *process->fullName}});
+            try
+            {
+                const auto& memoryRegions = memoryRegionsOfAllProcesses.emplace_back(
+                    process->memoryRegionExtractor->extractAllMemoryRegions());
+                for (const auto& memoryRegionDescriptor : *memoryRegions)
+                {
+                    addRegionScanJobs(scanJobs, process, memoryRegionDescriptor);
+                }
+            }
+            catch (const std::exception& exc)
+            {
+                logger->error("Error scanning process", {{"Name", *process->fullName}, {"Exception", exc.what()}});
+                pluginInterface->sendErrorEvent(exc.what());
+            }
+        }
+
+        regionScanPool.run(std::move(scanJobs));
+        logger->info("Done scanning all processes");
+    }
+
+    void Scanner::scanAllProcessesByFrames()
+    {
+        auto introspectionAPI = pluginInterface->getIntrospectionAPI();
+        auto processes = pluginInterface->getRunningProcesses();
+        // Keeps the region descriptors referenced by the owners alive
+        std::vector<std::unique_ptr<std::vector<MemoryRegion>>> memoryRegionsOfAllProcesses;
+        // Regions backed by the same frames at the same offsets have identical content, regardless of their process
+        std::map<std::vector<VmiCore::FrameRun>, std::vector<RegionOwner>> regionOwnersByFrames;
+
+        for (const auto& process : *processes)
+        {
+            if (process->pid == 0 || !shouldProcessBeScanned(*process))
+            {
+                continue;
+            }
+
+            try
+            {
+                const auto& memoryRegions = memoryRegionsOfAllProcesses.emplace_back(
+                    process->memoryRegionExtractor->extractAllMemoryRegions());
                 for (const auto& memoryRegionDescriptor : *memoryRegions)
                 {
-                    try
+                    if (!shouldRegionBeScanned(memoryRegionDescriptor))
                     {
-                        scanMemoryRegion(processInformation->pid,
-                                         processInformation->processUserDtb,
-                                         *processInformation->fullName,
-                                         memoryRegionDescriptor);
+                        continue;
                     }
-                    catch (const YaraTimeoutException&)
+
+                    auto frameRuns = introspectionAPI->getFrameRuns(memoryRegionDescriptor.base,
+                                                                    process->processUserDtb,
+                                                                    bytesToNumberOfPages(memoryRegionDescriptor.size));
+                    if (frameRuns.empty())
                     {
-                        logger->warning("Scan timeout reached",
-                                        {{"Process", *processInformation->fullName},
-                                         {"BaseVA", memoryRegionDescriptor.base},
-                                         {"Size", memoryRegionDescriptor.size}});
+                        continue;
                     }
-                    catch (const std::exception& exc)
+                    for (auto& frameRun : frameRuns)
                     {
-                        logger->error("Error scanning memory region of process",
-                                      {{"Name", *processInformation->fullName}, {"Exception", exc.what()}});
-                        pluginInterface->sendErrorEvent(exc.what());
+                        frameRun.guestBaseVA -= memoryRegionDescriptor.base;
                     }
+                    regionOwnersByFrames[std::move(frameRuns)].push_back(
+                        {.processInformation = process, .memoryRegionDescriptor = &memoryRegionDescriptor});
                 }
             }
             catch (const std::exception& exc)
             {
-                logger->error("Error scanning process",
-                              {{"Name", *processInformation->fullName}, {"Exception", exc.what()}});
+                logger->error("Error collecting frames of process",
+                              {{"Name", *process->fullName}, {"Exception", exc.what()}});
                 pluginInterface->sendErrorEvent(exc.what());
             }
-            logger->info("Done scanning process",
-                         {{"Pid", processInformation->pid}, {"Name", *processInformation->fullName}});
         }
+
+        logger->info("Scanning unique memory regions", {{"Count", regionOwnersByFrames.size()}});
+
+        std::vector<WorkStealingPool::Job> scanJobs;
+        scanJobs.reserve(regionOwnersByFrames.size());
+        for (const auto& [frameRuns, owners] : regionOwnersByFrames)
+        {
+            scanJobs.push_back({.cost = owners.front().memoryRegionDescriptor->size,
+                                .work = [this, &owners]() { scanSharedFrames(owners); }});
+        }
+        regionScanPool.run(std::move(scanJobs));
     }
 
-    void Scanner::scanAllProcesses()
+    void Scanner::scanSharedFrames(std::span<const RegionOwner> owners)
     {
-        auto processes = pluginInterface->getRunningProcesses();
-        std::vector<std::future<void>> scanProcessAsyncTasks;
-        for (const auto& process : *processes)
+        const auto& [firstProcess, firstMemoryRegionDescriptor] = owners.front();
+        logger->info("Scanning Memory region",
+                     {{"VA", fmt::format("{:x}", firstMemoryRegionDescriptor->base)},
+                      {"Size", firstMemoryRegionDescriptor->size},
+                      {"Module", firstMemoryRegionDescriptor->moduleName},
+                      {"Owners", owners.size()}});
+        try
         {
-            if (process->pid != 0)
+            auto memoryMapping =
+                pluginInterface->mapProcessMemoryRegion(firstMemoryRegionDescriptor->base,
+                                                        firstProcess->processUserDtb,
+                                                        bytesToNumberOfPages(firstMemoryRegionDescriptor->size));
+            auto mappedRegions = memoryMapping->getMappedRegions();
+
+            if (mappedRegions.empty())
             {
-                scanProcessAsyncTasks.push_back(std::async(&Scanner::scanProcess, this, process));
+                logger->debug("Extracted memory region has size 0, skipping");
+                return;
             }
+
+            if (configuration->isDumpingMemoryActivated())
+            {
+                for (const auto& [processInformation, memoryRegionDescriptor] : owners)
+                {
+                    dumping->dumpMemoryRegion(
+                        *processInformation->fullName,
+                        processInformation->pid,
+                        *memoryRegionDescriptor,
+                        rebaseMappedRegions(mappedRegions,
+                                            static_cast<int64_t>(memoryRegionDescriptor->base) -
+                                                static_cast<int64_t>(firstMemoryRegionDescriptor->base)));
+                }
+            }
+
+            auto results = matchMappedRegions(*firstMemoryRegionDescriptor, mappedRegions);
+            for (const auto& [processInformation, memoryRegionDescriptor] : owners)
+            {
+                reportResults(*processInformation->fullName,
+                              processInformation->pid,
+                              memoryRegionDescriptor->base,
+                              rebaseMatchPositions(results,
+                                                   static_cast<int64_t>(memoryRegionDescriptor->base) -
+                                                       static_cast<int64_t>(firstMemoryRegionDescriptor->base)));
+            }
+        }
+        catch (const YaraTimeoutException&)
+        {
+            logger->warning("Scan timeout reached",
+                            {{"Process", *firstProcess->fullName},
+                             {"BaseVA", firstMemoryRegionDescriptor->base},
+                             {"Size", firstMemoryRegionDescriptor->size}});
         }
-        for (auto& currentTask : scanProcessAsyncTasks)
+        catch (const std::exception& exc)
         {
-            currentTask.get();
+            logger->error("Error scanning memory region of process",
+                          {{"Name", *firstProcess->fullName}, {"Exception", exc.what()}});
+            pluginInterface->sendErrorEvent(exc.what());
         }
     }
 
@@ -224,18 +648,9 @@ namespace InMemoryScanner
     {
         if (configuration->isDumpingMemoryActivated())
         {
-            auto memoryRegionInformation = dumping->getAllMemoryRegionInformation();
-            std::ostringstream vts;
-
-            if (!memoryRegionInformation.empty())
-            {
-                std::copy(memoryRegionInformation.begin(),
-                          memoryRegionInformation.end(),
-                          std::ostream_iterator<std::string>(vts, "\n"));
-            }
-            pluginInterface->writeToFile(configuration->getOutputPath() /= "MemoryRegionInformation.json", vts.str());
+            dumping->saveOutput();
         }
-        pluginInterface->writeToFile(configuration->getOutputPath() /= XML_RESULT_FILENAME, *outputXml.getString());
+        resultWriter.finish();
     }
 
     void Scanner::logInMemoryResultToTextFile(const std::string& processName,
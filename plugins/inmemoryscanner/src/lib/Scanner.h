@@ -3,8 +3,12 @@
 #include "Config.h"
 #include "Dumping.h"
 #include "IYaraInterface.h"
-#include "OutputXML.h"
+#include "ResultWriter.h"
+#include "ScanResultCache.h"
+#include "ScanWorkerPool.h"
+#include "WorkStealingPool.h"
 #include <memory>
+#include <mutex>
 #include <semaphore>
 #include <span>
 #include <vmicore/plugins/PluginInterface.h>
@@ -24,29 +28,109 @@ namespace InMemoryScanner
 
         void scanProcess(std::shared_ptr<const VmiCore::ActiveProcessInformation> processInformation);
 
+        /**
+         * Copies the memory regions of a terminating process and scans the copies on a worker thread, so that the
+         * guest is only paused for as long as the copy takes.
+         */
+        void scanTerminatedProcess(std::shared_ptr<const VmiCore::ActiveProcessInformation> processInformation);
+
+        void waitForPendingScans();
+
+        /**
+         * Scans the memory of all running processes on a fixed number of workers, one memory region at a time and
+         * largest region first. If frame deduplication is activated, memory regions backed by the same guest frames
+         * are only scanned once and the results are attributed to every owning process.
+         */
         void scanAllProcesses();
 
         void saveOutput();
 
       private:
+        struct ProcessSnapshot
+        {
+            VmiCore::pid_t pid;
+            std::string processName;
+            std::unique_ptr<VmiCore::IMemorySnapshot> memorySnapshot;
+        };
+
+        // Collects the results of a memory region that is scanned in multiple chunks
+        struct ChunkedRegionScan
+        {
+            std::mutex lock;
+            std::size_t pendingChunks;
+            std::vector<Rule> results;
+        };
+
+        struct RegionOwner
+        {
+            std::shared_ptr<const VmiCore::ActiveProcessInformation> processInformation;
+            const VmiCore::MemoryRegion* memoryRegionDescriptor;
+        };
+
         VmiCore::Plugin::PluginInterface* pluginInterface;
         std::shared_ptr<IConfig> configuration;
         std::unique_ptr<IYaraInterface> yaraInterface;
-        OutputXML outputXml{};
+        ResultWriter resultWriter;
+        ScanResultCache scanResultCache{};
         std::unique_ptr<IDumping> dumping;
         std::unique_ptr<VmiCore::ILogger> logger;
         std::unique_ptr<VmiCore::ILogger> inMemResultsLogger;
         std::counting_semaphore<> semaphore{YR_MAX_THREADS};
+        WorkStealingPool regionScanPool;
+        // Declared last so that pending scans are finished before any other member is destroyed
+        ScanWorkerPool scanWorkerPool;
 
-        [[nodiscard]] bool shouldRegionBeScanned(const VmiCore::MemoryRegion& memoryRegionDescriptor);
+        [[nodiscard]] bool shouldProcessBeScanned(const VmiCore::ActiveProcessInformation& processInformation);
 
-        static std::vector<uint8_t> constructPaddedMemoryRegion(std::span<const VmiCore::MappedRegion> regions);
+        [[nodiscard]] bool shouldRegionBeScanned(const VmiCore::MemoryRegion& memoryRegionDescriptor);
 
         void scanMemoryRegion(pid_t pid,
                               uint64_t dtb,
                               const std::string& processName,
                               const VmiCore::MemoryRegion& memoryRegionDescriptor);
 
+        void scanMemoryRegionOfProcess(const VmiCore::ActiveProcessInformation& processInformation,
+                                       const VmiCore::MemoryRegion& memoryRegionDescriptor);
+
+        /**
+         * Adds the jobs for scanning a memory region. Regions larger than the configured chunk size are split into
+         * chunks that overlap by the maximum match length of the rules and are scanned independently.
+         */
+        void addRegionScanJobs(std::vector<WorkStealingPool::Job>& scanJobs,
+                               const std::shared_ptr<const VmiCore::ActiveProcessInformation>& processInformation,
+                               const VmiCore::MemoryRegion& memoryRegionDescriptor);
+
+        void scanMemoryRegionChunk(const VmiCore::ActiveProcessInformation& processInformation,
+                                   const VmiCore::MemoryRegion& memoryRegionDescriptor,
+                                   VmiCore::addr_t chunkBase,
+                                   std::size_t chunkSize,
+                                   ChunkedRegionScan& regionScan);
+
+        [[nodiscard]] std::vector<Rule> scanWithYara(std::span<const VmiCore::MappedRegion> mappedRegions);
+
+        void scanMappedRegions(pid_t pid,
+                               const std::string& processName,
+                               const VmiCore::MemoryRegion& memoryRegionDescriptor,
+                               std::span<const VmiCore::MappedRegion> mappedRegions);
+
+        [[nodiscard]] std::vector<Rule> matchMappedRegions(const VmiCore::MemoryRegion& memoryRegionDescriptor,
+                                                           std::span<const VmiCore::MappedRegion> mappedRegions);
+
+        void reportResults(const std::string& processName,
+                           VmiCore::pid_t pid,
+                           VmiCore::addr_t baseAddress,
+                           const std::vector<Rule>& results);
+
+        void scanAllProcessesByFrames();
+
+        /**
+         * Scans a memory region once for all owners, which have to be backed by the same guest frames at the same
+         * offsets relative to their region base.
+         */
+        void scanSharedFrames(std::span<const RegionOwner> owners);
+
+        void scanProcessSnapshot(const ProcessSnapshot& processSnapshot);
+
         void logInMemoryResultToTextFile(const std::string& processName,
                                          VmiCore::pid_t pid,
                                          VmiCore::addr_t baseAddress,
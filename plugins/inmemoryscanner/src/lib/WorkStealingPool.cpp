@@ -0,0 +1,81 @@
+#include "WorkStealingPool.h"
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+namespace InMemoryScanner
+{
+    WorkStealingPool::WorkStealingPool(std::size_t workerCount) : workerCount(workerCount)
+    {
+        if (workerCount == 0)
+        {
+            throw std::invalid_argument("Work stealing pool needs at least one worker");
+        }
+    }
+
+    void WorkStealingPool::run(std::vector<Job> jobs) const
+    {
+        if (jobs.empty())
+        {
+            return;
+        }
+
+        std::ranges::stable_sort(jobs, std::ranges::greater{}, &Job::cost);
+
+        std::vector<WorkerQueue> queues(std::min(workerCount, jobs.size()));
+        for (std::size_t i = 0; i < jobs.size(); i++)
+        {
+            queues[i % queues.size()].jobs.push_back(std::move(jobs[i].work));
+        }
+
+        std::vector<std::jthread> workers;
+        workers.reserve(queues.size());
+        for (std::size_t i = 0; i < queues.size(); i++)
+        {
+            workers.emplace_back(&WorkStealingPool::processJobs, std::span(queues), i);
+        }
+    }
+
+    void WorkStealingPool::processJobs(std::span<WorkerQueue> queues, std::size_t ownQueueIndex)
+    {
+        while (true)
+        {
+            auto job = takeMostExpensiveJob(queues[ownQueueIndex]);
+            for (std::size_t i = 1; !job && i < queues.size(); i++)
+            {
+                job = stealCheapestJob(queues[(ownQueueIndex + i) % queues.size()]);
+            }
+            // All jobs are known upfront, so no new work can appear once every queue is empty
+            if (!job)
+            {
+                return;
+            }
+
+            job();
+        }
+    }
+
+    std::function<void()> WorkStealingPool::takeMostExpensiveJob(WorkerQueue& queue)
+    {
+        std::scoped_lock lock(queue.lock);
+        if (queue.jobs.empty())
+        {
+            return {};
+        }
+        auto job = std::move(queue.jobs.front());
+        queue.jobs.pop_front();
+        return job;
+    }
+
+    std::function<void()> WorkStealingPool::stealCheapestJob(WorkerQueue& queue)
+    {
+        std::scoped_lock lock(queue.lock);
+        if (queue.jobs.empty())
+        {
+            return {};
+        }
+        auto job = std::move(queue.jobs.back());
+        queue.jobs.pop_back();
+        return job;
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <vector>
+
+namespace InMemoryScanner
+{
+    /**
+     * Runs a batch of jobs on a fixed number of worker threads. Jobs are sorted by descending cost and dealt out to
+     * per-worker queues. Each worker takes the most expensive job of its own queue and steals the cheapest job of
+     * another worker once its own queue is empty. Expensive jobs are therefore started first, which keeps a single
+     * large job from prolonging the whole batch, and no worker idles while jobs are left.
+     */
+    class WorkStealingPool
+    {
+      public:
+        struct Job
+        {
+            std::size_t cost;
+            std::function<void()> work;
+        };
+
+        explicit WorkStealingPool(std::size_t workerCount);
+
+        /**
+         * Blocks until all jobs have been processed. Jobs are expected to handle their own errors.
+         */
+        void run(std::vector<Job> jobs) const;
+
+      private:
+        struct WorkerQueue
+        {
+            std::mutex lock;
+            std::deque<std::function<void()>> jobs;
+        };
+
+        std::size_t workerCount;
+
+        static void processJobs(std::span<WorkerQueue> queues, std::size_t ownQueueIndex);
+
+        static std::function<void()> takeMostExpensiveJob(WorkerQueue& queue);
+
+        static std::function<void()> stealCheapestJob(WorkerQueue& queue);
+    };
+}
@@ -1,18 +1,15 @@
 #include "YaraInterface.h"
+#include <algorithm>
 #include <fmt/core.h>
 
 using VmiCore::addr_t;
 using VmiCore::MappedRegion;
 using VmiCore::PagingDefinitions::pageSizeInBytes;
 
+using InMemoryScanner::YaraIteratorContext;
+
 namespace
 {
-    struct YaraIteratorContext
-    {
-        std::vector<YR_MEMORY_BLOCK> blocks;
-        std::size_t index;
-    };
-
     YR_MEMORY_BLOCK* get_next_block(YR_MEMORY_BLOCK_ITERATOR* iterator)
     {
         if (auto* iteratorContext = static_cast<YaraIteratorContext*>(iterator->context);
@@ -28,6 +25,10 @@ namespace
     {
         auto* iteratorContext = static_cast<YaraIteratorContext*>(iterator->context);
         iteratorContext->index = 0;
+        if (iteratorContext->blocks.empty())
+        {
+            return nullptr;
+        }
 
         return &iteratorContext->blocks[iteratorContext->index];
     }
@@ -40,7 +41,8 @@ namespace
 
 namespace InMemoryScanner
 {
-    YaraInterface::YaraInterface(const std::string& rulesFile, int scanTimeout) : scanTimeout(scanTimeout)
+    YaraInterface::YaraInterface(const std::string& rulesFile, int scanTimeout, bool useLiteralPrefilter)
+        : scanTimeout(scanTimeout)
     {
         auto err = yr_initialize();
         if (err != ERROR_SUCCESS)
@@ -53,10 +55,18 @@ namespace InMemoryScanner
         {
             throw YaraException(fmt::format("Cannot load rules. Error code: {}", err));
         }
+
+        determineMaximumMatchLength();
+        if (useLiteralPrefilter)
+        {
+            literalPrefilter = buildLiteralPrefilter();
+        }
     }
 
     YaraInterface::~YaraInterface()
     {
+        // Scanners refer to the rules and therefore have to be destroyed first
+        idleScanners.clear();
         if (rules)
         {
             yr_rules_destroy(rules);
@@ -64,12 +74,127 @@ namespace InMemoryScanner
         }
     }
 
+    void YaraInterface::determineMaximumMatchLength()
+    {
+        // Matches of regular expressions and hex strings are limited by the scan limit of the regex engine, literal
+        // strings match exactly their length
+        maximumMatchLength = YR_RE_SCAN_LIMIT;
+
+        YR_RULE* rule = nullptr;
+        YR_STRING* string = nullptr;
+        yr_rules_foreach(rules, rule) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        {
+            yr_rule_strings_foreach(rule, string) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            {
+                maximumMatchLength = std::max(maximumMatchLength, static_cast<std::size_t>(string->length));
+            }
+        }
+    }
+
+    std::size_t YaraInterface::getMaximumMatchLength() const
+    {
+        return maximumMatchLength;
+    }
+
+    bool YaraInterface::isLiteralPrefilterActive() const
+    {
+        return literalPrefilter.has_value();
+    }
+
+    std::optional<LiteralPrefilter> YaraInterface::buildLiteralPrefilter() const
+    {
+        std::vector<LiteralPrefilter::Literal> literals;
+
+        YR_RULE* rule = nullptr;
+        YR_STRING* string = nullptr;
+        yr_rules_foreach(rules, rule) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        {
+            // Yara does not evaluate the condition of a rule unless this many of its strings have matched. Rules
+            // without required strings, e.g. ones that only check module data, may match memory without any literal.
+            if (rule->required_strings == 0)
+            {
+                return std::nullopt;
+            }
+
+            yr_rule_strings_foreach(rule, string) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            {
+                if (!STRING_IS_LITERAL(string) || STRING_IS_XOR(string) || STRING_IS_BASE64(string) ||
+                    STRING_IS_BASE64_WIDE(string))
+                {
+                    return std::nullopt;
+                }
+
+                auto bytes = std::span(string->string, static_cast<std::size_t>(string->length));
+                auto caseInsensitive = STRING_IS_NO_CASE(string) != 0;
+                if (STRING_IS_ASCII(string) || !STRING_IS_WIDE(string))
+                {
+                    literals.push_back({{bytes.begin(), bytes.end()}, caseInsensitive});
+                }
+                if (STRING_IS_WIDE(string))
+                {
+                    std::vector<uint8_t> wideBytes;
+                    wideBytes.reserve(bytes.size() * 2);
+                    for (auto character : bytes)
+                    {
+                        wideBytes.push_back(character);
+                        wideBytes.push_back(0);
+                    }
+                    literals.push_back({std::move(wideBytes), caseInsensitive});
+                }
+            }
+        }
+
+        return LiteralPrefilter(std::move(literals));
+    }
+
+    std::unique_ptr<YaraInterface::ScannerContext> YaraInterface::acquireScanner()
+    {
+        {
+            std::scoped_lock lock(idleScannersLock);
+            if (!idleScanners.empty())
+            {
+                auto scannerContext = std::move(idleScanners.back());
+                idleScanners.pop_back();
+                return scannerContext;
+            }
+        }
+
+        YR_SCANNER* scanner = nullptr;
+        if (auto err = yr_scanner_create(rules, &scanner); err != ERROR_SUCCESS)
+        {
+            throw YaraException(fmt::format("Cannot create scanner. Error code: {}", err));
+        }
+        auto scannerContext = std::make_unique<ScannerContext>(
+            ScannerContext{.scanner = {scanner, &yr_scanner_destroy}, .iteratorContext = {}});
+        yr_scanner_set_flags(scanner, SCAN_FLAGS_PROCESS_MEMORY | SCAN_FLAGS_REPORT_RULES_MATCHING);
+        yr_scanner_set_timeout(scanner, scanTimeout);
+
+        return scannerContext;
+    }
+
+    void YaraInterface::releaseScanner(std::unique_ptr<ScannerContext> scannerContext)
+    {
+        std::scoped_lock lock(idleScannersLock);
+        idleScanners.push_back(std::move(scannerContext));
+    }
+
     std::vector<Rule> YaraInterface::scanMemory(std::span<const MappedRegion> mappedRegions)
     {
         std::vector<Rule> results;
+        // Matches never span multiple blocks, so every block can be checked on its own
+        if (literalPrefilter &&
+            std::ranges::none_of(mappedRegions,
+                                 [this](const MappedRegion& mappedRegion)
+                                 { return literalPrefilter->containsAnyLiteral(mappedRegion.asSpan()); }))
+        {
+            return results;
+        }
 
-        YaraIteratorContext iteratorContext{};
-        iteratorContext.blocks.reserve(mappedRegions.size());
+        auto scannerContext = acquireScanner();
+
+        auto& iteratorContext = scannerContext->iteratorContext;
+        // Keeps the capacity of previous scans, so no allocation is needed in most cases
+        iteratorContext.blocks.clear();
         for (const auto& mappedRegion : mappedRegions)
         {
             iteratorContext.blocks.emplace_back(mappedRegion.num_pages * pageSizeInBytes,
@@ -84,13 +209,11 @@ namespace InMemoryScanner
                                           .file_size = nullptr,
                                           .last_error = ERROR_SUCCESS};
 
-        if (auto err = yr_rules_scan_mem_blocks(rules,
-                                                &iterator,
-                                                SCAN_FLAGS_PROCESS_MEMORY | SCAN_FLAGS_REPORT_RULES_MATCHING,
-                                                yaraCallback,
-                                                &results,
-                                                scanTimeout);
-            err != ERROR_SUCCESS)
+        yr_scanner_set_callback(scannerContext->scanner.get(), yaraCallback, &results);
+        auto err = yr_scanner_scan_mem_blocks(scannerContext->scanner.get(), &iterator);
+        releaseScanner(std::move(scannerContext));
+
+        if (err != ERROR_SUCCESS)
         {
             if (err == ERROR_SCAN_TIMEOUT)
             {
@@ -2,19 +2,40 @@
 
 #include "Common.h"
 #include "IYaraInterface.h"
+#include "LiteralPrefilter.h"
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <vector>
 #include <yara.h>
 
 namespace InMemoryScanner
 {
+    struct YaraIteratorContext
+    {
+        std::vector<YR_MEMORY_BLOCK> blocks;
+        std::size_t index;
+    };
+
     class YaraInterface : public IYaraInterface
     {
       public:
-        YaraInterface(const std::string& rulesFile, int scanTimeout);
+        /**
+         * @param useLiteralPrefilter Skips scanning memory that contains none of the literals of the rules, if every
+         * rule requires at least one of its strings to match and all strings are plain literals. Otherwise the
+         * prefilter cannot rule out a match and stays inactive.
+         */
+        YaraInterface(const std::string& rulesFile, int scanTimeout, bool useLiteralPrefilter);
 
         YaraInterface(const YaraInterface& other) = delete;
 
-        YaraInterface(YaraInterface&& other) noexcept : rules(other.rules)
+        YaraInterface(YaraInterface&& other) noexcept
+            : scanTimeout(other.scanTimeout),
+              maximumMatchLength(other.maximumMatchLength),
+              rules(other.rules),
+              literalPrefilter(std::move(other.literalPrefilter)),
+              idleScanners(std::move(other.idleScanners))
         {
             other.rules = nullptr;
         }
@@ -28,6 +49,10 @@ namespace InMemoryScanner
                 return *this;
             }
 
+            scanTimeout = other.scanTimeout;
+            maximumMatchLength = other.maximumMatchLength;
+            idleScanners = std::move(other.idleScanners);
+            literalPrefilter = std::move(other.literalPrefilter);
             rules = other.rules;
             other.rules = nullptr;
 
@@ -38,9 +63,36 @@ namespace InMemoryScanner
 
         std::vector<Rule> scanMemory(std::span<const VmiCore::MappedRegion> mappedRegions) override;
 
+        [[nodiscard]] std::size_t getMaximumMatchLength() const override;
+
+        [[nodiscard]] bool isLiteralPrefilterActive() const;
+
       private:
+        /**
+         * A yara scanner together with the memory needed for describing the scanned blocks. Both are reused for
+         * subsequent scans, which avoids setting up a new scan context for every memory region.
+         */
+        struct ScannerContext
+        {
+            std::unique_ptr<YR_SCANNER, decltype(&yr_scanner_destroy)> scanner;
+            YaraIteratorContext iteratorContext;
+        };
+
         int scanTimeout;
+        std::size_t maximumMatchLength = YR_RE_SCAN_LIMIT;
         YR_RULES* rules = nullptr;
+        std::optional<LiteralPrefilter> literalPrefilter;
+        // Scanners are not thread safe, so every scanning thread takes its own one from here and returns it afterwards
+        std::mutex idleScannersLock;
+        std::vector<std::unique_ptr<ScannerContext>> idleScanners;
+
+        void determineMaximumMatchLength();
+
+        [[nodiscard]] std::optional<LiteralPrefilter> buildLiteralPrefilter() const;
+
+        std::unique_ptr<ScannerContext> acquireScanner();
+
+        void releaseScanner(std::unique_ptr<ScannerContext> scannerContext);
 
         static int yaraCallback(YR_SCAN_CONTEXT* context, int message, void* message_data, void* user_data);
 
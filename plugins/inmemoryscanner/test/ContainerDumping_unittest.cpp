@@ -0,0 +1,258 @@
+#include "mock_Config.h"
+#include <ContainerDumping.h>
+#include <DumpContainerReader.h>
+#include <filesystem>
+#include <fstream>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <optional>
+#include <thread>
+#include <vmicore/os/PagingDefinitions.h>
+#include <vmicore_test/io/mock_Logger.h>
+#include <vmicore_test/os/mock_PageProtection.h>
+#include <vmicore_test/plugins/mock_PluginInterface.h>
+
+using testing::_;
+using testing::NiceMock;
+using testing::Return;
+using VmiCore::addr_t;
+using VmiCore::MappedRegion;
+using VmiCore::MemoryRegion;
+using VmiCore::MockLogger;
+using VmiCore::MockPageProtection;
+using VmiCore::PagingDefinitions::pageSizeInBytes;
+using VmiCore::Plugin::MockPluginInterface;
+
+namespace InMemoryScanner
+{
+    class ContainerDumpingFixture : public testing::Test
+    {
+      protected:
+        const addr_t startAddress = 0x1234000;
+        std::filesystem::path resultsDirectory;
+        std::filesystem::path containerPath;
+        std::unique_ptr<NiceMock<MockPluginInterface>> pluginInterface =
+            std::make_unique<NiceMock<MockPluginInterface>>();
+        std::shared_ptr<NiceMock<MockConfig>> configuration = std::make_shared<NiceMock<MockConfig>>();
+        std::optional<ContainerDumping> dumping;
+
+        void SetUp() override
+        {
+            resultsDirectory = std::filesystem::temp_directory_path() / "ContainerDumping_unittest" /
+                               testing::UnitTest::GetInstance()->current_test_info()->name();
+            std::filesystem::remove_all(resultsDirectory);
+            containerPath = resultsDirectory / "inMemDumps" / "dumpedRegions.imdump";
+
+            ON_CALL(*pluginInterface, newNamedLogger(_))
+                .WillByDefault([]() { return std::make_unique<NiceMock<MockLogger>>(); });
+            // Behaves like the file transport of VMICore, which places files in the results directory
+            ON_CALL(*pluginInterface, appendToFile(_, _))
+                .WillByDefault(
+                    [this](const std::string& filename, std::span<const uint8_t> data)
+                    {
+                        std::filesystem::create_directories((resultsDirectory / filename).parent_path());
+                        std::ofstream file(resultsDirectory / filename, std::ios::binary | std::ios::app);
+                        file.write(reinterpret_cast<const char*>(data.data()),
+                                   static_cast<std::streamsize>(data.size()));
+                    });
+            ON_CALL(*configuration, getOutputPath()).WillByDefault(Return("inMemDumps"));
+            dumping.emplace(pluginInterface.get(), configuration);
+        }
+
+        void TearDown() override
+        {
+            dumping.reset();
+            std::filesystem::remove_all(resultsDirectory);
+        }
+
+        static MemoryRegion createMemoryRegion(addr_t base, std::size_t size)
+        {
+            auto protection = std::make_unique<NiceMock<MockPageProtection>>();
+            ON_CALL(*protection, toString()).WillByDefault(Return("RWX"));
+            return {base, size, "C:\\Windows\\System32\\kernel32.dll", std::move(protection), true, false, true};
+        }
+
+        // Every page gets a different content, so misplaced pages are detected
+        static std::vector<uint8_t> createDistinctPages(std::size_t numberOfPages)
+        {
+            std::vector<uint8_t> pages(numberOfPages * pageSizeInBytes);
+            std::iota(pages.begin(), pages.end(), 0);
+            for (std::size_t i = 0; i < numberOfPages; i++)
+            {
+                pages[i * pageSizeInBytes] = static_cast<uint8_t>(i);
+            }
+            return pages;
+        }
+    };
+
+    TEST_F(ContainerDumpingFixture, dumpMemoryRegion_regionWithUnmappedAndZeroPages_regionReadBackWithZeroFill)
+    {
+        auto regionSize = 5 * pageSizeInBytes;
+        auto memoryRegion = createMemoryRegion(startAddress, regionSize);
+        // Layout: data page, unmapped page, zero page followed by a data page, unmapped page
+        auto firstChunk = std::vector<uint8_t>(pageSizeInBytes, 0xCA);
+        auto secondChunk = std::vector<uint8_t>(pageSizeInBytes, 0);
+        auto distinctPage = createDistinctPages(1);
+        secondChunk.insert(secondChunk.end(), distinctPage.begin(), distinctPage.end());
+        std::vector<MappedRegion> mappedRegions{{startAddress, firstChunk},
+                                                {startAddress + 2 * pageSizeInBytes, secondChunk}};
+        auto expectedContent = std::vector<uint8_t>(regionSize, 0);
+        std::ranges::copy(firstChunk, expectedContent.begin());
+        std::ranges::copy(secondChunk, std::next(expectedContent.begin(), 2 * pageSizeInBytes));
+
+        dumping->dumpMemoryRegion("process.exe", 123, memoryRegion, mappedRegions);
+        dumping->saveOutput();
+
+        DumpContainerReader reader(containerPath);
+        ASSERT_EQ(reader.getRegions().size(), 1);
+        const auto& region = reader.getRegions().front();
+        EXPECT_EQ(region.pid, 123);
+        EXPECT_EQ(region.baseVA, startAddress);
+        EXPECT_EQ(region.size, regionSize);
+        EXPECT_EQ(region.protection, "RWX");
+        EXPECT_EQ(region.processName, "process.exe");
+        EXPECT_EQ(region.moduleName, "C:\\Windows\\System32\\kernel32.dll");
+        EXPECT_TRUE(region.isSharedMemory);
+        EXPECT_FALSE(region.isBeingDeleted);
+        EXPECT_TRUE(region.isProcessBaseImage);
+        ASSERT_EQ(region.extents.size(), 3);
+        EXPECT_EQ(region.extents[0].type, DumpContainer::ExtentType::Zstd);
+        EXPECT_EQ(region.extents[1], (DumpContainer::PageExtent{2, 1, DumpContainer::ExtentType::Zero, 0, 0}));
+        EXPECT_EQ(region.extents[2].firstPage, 3);
+        EXPECT_EQ(reader.readRegion(0), expectedContent);
+    }
+
+    TEST_F(ContainerDumpingFixture, read_rangeSpanningSeveralFrames_onlyRequestedBytesReturned)
+    {
+        constexpr std::size_t numberOfPages = 150;
+        auto memoryRegion = createMemoryRegion(startAddress, numberOfPages * pageSizeInBytes);
+        auto pages = createDistinctPages(numberOfPages);
+        std::vector<MappedRegion> mappedRegions{{startAddress, pages}};
+        auto offset = 63 * pageSizeInBytes + 100;
+        auto buffer = std::vector<uint8_t>(70 * pageSizeInBytes);
+
+        dumping->dumpMemoryRegion("process.exe", 123, memoryRegion, mappedRegions);
+        dumping->saveOutput();
+        DumpContainerReader reader(containerPath);
+        reader.read(0, offset, buffer);
+
+        EXPECT_GT(reader.getRegions().front().extents.size(), 1);
+        EXPECT_TRUE(std::ranges::equal(buffer, std::span(pages).subspan(offset, buffer.size())));
+    }
+
+    TEST_F(ContainerDumpingFixture, dumpMemoryRegion_multipleRegions_allRegionsIndexed)
+    {
+        auto firstPages = createDistinctPages(2);
+        auto secondPages = std::vector<uint8_t>(pageSizeInBytes, 0x11);
+        auto secondStartAddress = startAddress + 0x100000;
+        std::vector<MappedRegion> firstMappings{{startAddress, firstPages}};
+        std::vector<MappedRegion> secondMappings{{secondStartAddress, secondPages}};
+
+        dumping->dumpMemoryRegion("first.exe", 1, createMemoryRegion(startAddress, firstPages.size()), firstMappings);
+        dumping->dumpMemoryRegion(
+            "second.exe", 2, createMemoryRegion(secondStartAddress, secondPages.size()), secondMappings);
+        dumping->saveOutput();
+
+        DumpContainerReader reader(containerPath);
+        ASSERT_EQ(reader.getRegions().size(), 2);
+        EXPECT_EQ(reader.getRegions()[0].processName, "first.exe");
+        EXPECT_EQ(reader.getRegions()[1].regionId, 1);
+        EXPECT_EQ(reader.readRegion(0), firstPages);
+        EXPECT_EQ(reader.readRegion(1), secondPages);
+    }
+
+    TEST_F(ContainerDumpingFixture, dumpMemoryRegion_concurrentRegionsWithFewBuffers_framesStoredInPageOrder)
+    {
+        constexpr std::size_t numberOfRegions = 4;
+        constexpr std::size_t numberOfPages = 1000;
+        ON_CALL(*configuration, getDumpCompressionThreads()).WillByDefault(Return(2));
+        // Start over with an empty container, the transport only ever appends
+        dumping.reset();
+        std::filesystem::remove_all(resultsDirectory);
+        dumping.emplace(pluginInterface.get(), configuration);
+        auto pages = createDistinctPages(numberOfPages);
+        std::vector<MappedRegion> mappedRegions{{startAddress, pages}};
+
+        {
+            std::vector<std::jthread> dumpingThreads;
+            for (std::size_t i = 0; i < numberOfRegions; i++)
+            {
+                dumpingThreads.emplace_back(
+                    [this, &pages, &mappedRegions]()
+                    {
+                        dumping->dumpMemoryRegion(
+                            "process.exe", 123, createMemoryRegion(startAddress, pages.size()), mappedRegions);
+                    });
+            }
+        }
+        dumping->saveOutput();
+
+        DumpContainerReader reader(containerPath);
+        ASSERT_EQ(reader.getRegions().size(), numberOfRegions);
+        for (std::size_t i = 0; i < numberOfRegions; i++)
+        {
+            const auto& extents = reader.getRegions()[i].extents;
+            ASSERT_FALSE(extents.empty());
+            EXPECT_EQ(extents.front().firstPage, 0);
+            for (std::size_t j = 1; j < extents.size(); j++)
+            {
+                EXPECT_EQ(extents[j].firstPage, extents[j - 1].firstPage + extents[j - 1].numberOfPages);
+            }
+            EXPECT_EQ(reader.readRegion(i), pages);
+        }
+    }
+
+    TEST_F(ContainerDumpingFixture, dumpMemoryRegion_mappingBelowRegionBase_throws)
+    {
+        auto pages = createDistinctPages(1);
+        std::vector<MappedRegion> mappedRegions{{startAddress - 0x100000, pages}};
+
+        EXPECT_THROW(dumping->dumpMemoryRegion(
+                         "process.exe", 123, createMemoryRegion(startAddress, pages.size()), mappedRegions),
+                     std::invalid_argument);
+    }
+
+    TEST_F(ContainerDumpingFixture, constructor_outputNotSaved_containerRejectedAsIncomplete)
+    {
+        auto pages = createDistinctPages(1);
+        std::vector<MappedRegion> mappedRegions{{startAddress, pages}};
+
+        dumping->dumpMemoryRegion("process.exe", 123, createMemoryRegion(startAddress, pages.size()), mappedRegions);
+
+        EXPECT_THROW(DumpContainerReader{containerPath}, DumpContainer::FormatException);
+    }
+
+    TEST_F(ContainerDumpingFixture, read_rangeExceedsRegion_throws)
+    {
+        auto pages = createDistinctPages(1);
+        std::vector<MappedRegion> mappedRegions{{startAddress, pages}};
+        dumping->dumpMemoryRegion("process.exe", 123, createMemoryRegion(startAddress, pages.size()), mappedRegions);
+        dumping->saveOutput();
+        DumpContainerReader reader(containerPath);
+        auto buffer = std::vector<uint8_t>(2);
+
+        EXPECT_THROW(reader.read(0, pageSizeInBytes - 1, buffer), std::out_of_range);
+    }
+
+    TEST(DumpContainerFormatTest, parseIndex_serializedIndex_equalRegions)
+    {
+        DumpContainer::PageExtent extent{0, 2, DumpContainer::ExtentType::Raw, 32, 2 * pageSizeInBytes};
+        std::vector<DumpContainer::RegionEntry> regions{
+            {1, 0, 0x1000, 0x3000, true, true, false, "RW", "a.exe", "", {extent}},
+            {2, 1, 0x5000, 0x1000, false, false, true, "RX", "b.exe", "b.dll", {}}};
+
+        EXPECT_EQ(DumpContainer::parseIndex(DumpContainer::serializeIndex(regions)), regions);
+    }
+
+    TEST(DumpContainerFormatTest, parseIndex_truncatedIndex_throws)
+    {
+        DumpContainer::PageExtent extent{0, 2, DumpContainer::ExtentType::Raw, 32, 2 * pageSizeInBytes};
+        std::vector<DumpContainer::RegionEntry> regions{
+            {1, 0, 0x1000, 0x3000, true, true, false, "RW", "a.exe", "", {extent}}};
+        auto index = DumpContainer::serializeIndex(regions);
+
+        EXPECT_THROW(auto parsedRegions = DumpContainer::parseIndex(std::span(index).first(index.size() - 1)),
+                     DumpContainer::FormatException);
+    }
+}
@@ -16,4 +16,9 @@ namespace InMemoryScanner
         concurrentThreads--;
         return {};
     }
+
+    std::size_t FakeYaraInterface::getMaximumMatchLength() const
+    {
+        return 0;
+    }
 }
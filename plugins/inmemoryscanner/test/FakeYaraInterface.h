@@ -9,6 +9,8 @@ namespace InMemoryScanner
       public:
         std::vector<Rule> scanMemory(std::span<const VmiCore::MappedRegion> mappedRegions) override;
 
+        [[nodiscard]] std::size_t getMaximumMatchLength() const override;
+
         bool max_threads_exceeded = false;
 
       private:
@@ -0,0 +1,101 @@
+#include <LiteralPrefilter.h>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+#include <string_view>
+
+namespace InMemoryScanner
+{
+    namespace
+    {
+        LiteralPrefilter::Literal toLiteral(std::string_view string, bool caseInsensitive = false)
+        {
+            return {{string.begin(), string.end()}, caseInsensitive};
+        }
+
+        std::vector<uint8_t> constructMemoryWithContent(std::size_t size, std::string_view string, std::size_t offset)
+        {
+            std::vector<uint8_t> memory(size, 0xCC);
+            std::ranges::copy(string, std::next(memory.begin(), static_cast<std::ptrdiff_t>(offset)));
+            return memory;
+        }
+
+        bool containsLiteralNaive(const std::vector<LiteralPrefilter::Literal>& literals,
+                                  const std::vector<uint8_t>& memory)
+        {
+            return std::ranges::any_of(literals,
+                                       [&memory](const LiteralPrefilter::Literal& literal)
+                                       { return !std::ranges::search(memory, literal.bytes).empty(); });
+        }
+    }
+
+    TEST(LiteralPrefilterTest, containsAnyLiteral_literalAtEveryOffset_found)
+    {
+        LiteralPrefilter prefilter({toLiteral("needle"), toLiteral("other")});
+
+        for (std::size_t offset = 0; offset <= 64 - std::string_view("needle").size(); offset++)
+        {
+            EXPECT_TRUE(prefilter.containsAnyLiteral(constructMemoryWithContent(64, "needle", offset)))
+                << "Offset " << offset;
+        }
+    }
+
+    TEST(LiteralPrefilterTest, containsAnyLiteral_literalTruncatedAtEnd_notFound)
+    {
+        LiteralPrefilter prefilter({toLiteral("needle")});
+        auto memory = constructMemoryWithContent(64, "needl", 59);
+
+        EXPECT_FALSE(prefilter.containsAnyLiteral(memory));
+    }
+
+    TEST(LiteralPrefilterTest, containsAnyLiteral_singleByteLiteralInLastByte_found)
+    {
+        LiteralPrefilter prefilter({toLiteral("X")});
+        auto memory = constructMemoryWithContent(64, "X", 63);
+
+        EXPECT_TRUE(prefilter.containsAnyLiteral(memory));
+    }
+
+    TEST(LiteralPrefilterTest, containsAnyLiteral_caseInsensitiveLiteralWithDifferentCase_found)
+    {
+        LiteralPrefilter prefilter({toLiteral("NeEdLe", true), toLiteral("Other")});
+
+        EXPECT_TRUE(prefilter.containsAnyLiteral(constructMemoryWithContent(64, "nEEDle", 20)));
+        EXPECT_FALSE(prefilter.containsAnyLiteral(constructMemoryWithContent(64, "oTHER", 20)));
+    }
+
+    TEST(LiteralPrefilterTest, containsAnyLiteral_noLiterals_nothingFound)
+    {
+        LiteralPrefilter prefilter({});
+
+        EXPECT_FALSE(prefilter.containsAnyLiteral(constructMemoryWithContent(64, "needle", 0)));
+    }
+
+    TEST(LiteralPrefilterTest, containsAnyLiteral_randomLiteralsAndMemory_sameResultAsNaiveSearch)
+    {
+        std::mt19937 generator(1234);
+        // A small alphabet makes partial matches and therefore false candidates frequent
+        std::uniform_int_distribution<int> byteDistribution('a', 'd');
+        std::uniform_int_distribution<std::size_t> lengthDistribution(1, 10);
+        auto randomBytes = [&](std::size_t length)
+        {
+            std::vector<uint8_t> bytes(length);
+            std::ranges::generate(bytes, [&]() { return static_cast<uint8_t>(byteDistribution(generator)); });
+            return bytes;
+        };
+
+        for (int round = 0; round < 500; round++)
+        {
+            std::vector<LiteralPrefilter::Literal> literals;
+            for (std::size_t i = 0; i < 1 + static_cast<std::size_t>(round % 20); i++)
+            {
+                literals.push_back({randomBytes(lengthDistribution(generator)), false});
+            }
+            LiteralPrefilter prefilter(literals);
+            auto memory = randomBytes(static_cast<std::size_t>(round % 97));
+
+            EXPECT_EQ(prefilter.containsAnyLiteral(memory), containsLiteralNaive(literals, memory))
+                << "Round " << round;
+        }
+    }
+}
@@ -0,0 +1,172 @@
+#include <ResultWriter.h>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <optional>
+#include <sstream>
+#include <thread>
+#include <vmicore_test/plugins/mock_PluginInterface.h>
+
+using testing::_;
+using testing::An;
+using testing::NiceMock;
+using VmiCore::Plugin::MockPluginInterface;
+
+namespace InMemoryScanner
+{
+    class ResultWriterFixture : public testing::Test
+    {
+      protected:
+        const std::filesystem::path resultFilename = std::filesystem::path("inMemDumps") / "results";
+        std::unique_ptr<NiceMock<MockPluginInterface>> pluginInterface =
+            std::make_unique<NiceMock<MockPluginInterface>>();
+        std::optional<ResultWriter> resultWriter;
+        std::string fileContent;
+
+        void SetUp() override
+        {
+            ON_CALL(*pluginInterface, appendToFile(resultFilename.string(), _))
+                .WillByDefault([this](const std::string&, std::span<const uint8_t> data)
+                               { fileContent.append(data.begin(), data.end()); });
+            ON_CALL(*pluginInterface, writeToFile(resultFilename.string(), An<const std::string&>()))
+                .WillByDefault([this](const std::string&, const std::string& message) { fileContent.append(message); });
+        }
+
+        void createResultWriter(ResultFormat format)
+        {
+            resultWriter.emplace(pluginInterface.get(), resultFilename, format);
+        }
+    };
+
+    TEST_F(ResultWriterFixture, finish_xmlFormat_resultsWrittenAsCompleteDocument)
+    {
+        std::vector<Rule> results{{.ruleName = "rule", .ruleNamespace = "ns", .matches = {{"$a", 0x10}, {"$b", 0x20}}}};
+        createResultWriter(ResultFormat::Xml);
+
+        resultWriter->addResult("a&b.exe", 4, 0x1000, results);
+        resultWriter->finish();
+
+        EXPECT_EQ(fileContent,
+                  "<?xml version=\"1.0\"?>\n"
+                  "<root>\n"
+                  "\t<process name=\"a&amp;b.exe\" pid=\"4\">\n"
+                  "\t\t<rule namespace=\"ns\" name=\"rule\">\n"
+                  "\t\t\t<match name=\"$a\" position=\"4112\"/>\n"
+                  "\t\t\t<match name=\"$b\" position=\"4128\"/>\n"
+                  "\t\t</rule>\n"
+                  "\t</process>\n"
+                  "</root>\n");
+    }
+
+    TEST_F(ResultWriterFixture, finish_ndjsonFormat_oneEscapedLinePerResult)
+    {
+        std::vector<Rule> firstResults{{.ruleName = "first", .ruleNamespace = "ns", .matches = {{"$a", 0x10}}}};
+        std::vector<Rule> secondResults{{.ruleName = "second", .ruleNamespace = "ns", .matches = {}}};
+        createResultWriter(ResultFormat::Ndjson);
+
+        resultWriter->addResult(R"(C:\"a".exe)", 4, 0x1000, firstResults);
+        resultWriter->addResult("b.exe", 8, 0x2000, secondResults);
+        resultWriter->finish();
+
+        EXPECT_EQ(fileContent,
+                  R"({"process":"C:\\\"a\".exe","pid":4,"baseAddress":4096,"rules":[{"namespace":"ns","name":"first",)"
+                  R"("matches":[{"name":"$a","position":4112}]}]})"
+                  "\n"
+                  R"({"process":"b.exe","pid":8,"baseAddress":8192,"rules":[{"namespace":"ns","name":"second",)"
+                  R"("matches":[]}]})"
+                  "\n");
+    }
+
+    TEST_F(ResultWriterFixture, flush_ndjsonResultsNotFinished_resultsAlreadyWritten)
+    {
+        std::vector<Rule> results{{.ruleName = "rule", .ruleNamespace = "ns", .matches = {{"$a", 0}}}};
+        createResultWriter(ResultFormat::Ndjson);
+
+        resultWriter->addResult("a.exe", 4, 0x1000, results);
+        resultWriter->flush();
+
+        EXPECT_NE(fileContent.find(R"("name":"rule")"), std::string::npos);
+    }
+
+    TEST_F(ResultWriterFixture, constructor_noResults_noFileWritten)
+    {
+        EXPECT_CALL(*pluginInterface, appendToFile(_, _)).Times(0);
+        EXPECT_CALL(*pluginInterface, writeToFile(_, An<const std::string&>())).Times(0);
+
+        createResultWriter(ResultFormat::Ndjson);
+        resultWriter->flush();
+    }
+
+    TEST_F(ResultWriterFixture, finish_xmlResultsAddedInDifferentOrder_sameOutput)
+    {
+        std::vector<Rule> firstResults{{.ruleName = "first", .ruleNamespace = "ns", .matches = {{"$a", 0x10}}}};
+        std::vector<Rule> secondResults{{.ruleName = "second", .ruleNamespace = "ns", .matches = {{"$b", 0x20}}}};
+        std::vector<Rule> thirdResults{{.ruleName = "third", .ruleNamespace = "ns", .matches = {{"$c", 0x30}}}};
+        createResultWriter(ResultFormat::Xml);
+        resultWriter->addResult("a.exe", 4, 0x1000, firstResults);
+        resultWriter->addResult("a.exe", 4, 0x2000, secondResults);
+        resultWriter->addResult("b.exe", 8, 0x1000, thirdResults);
+        resultWriter->finish();
+        auto output = fileContent;
+        fileContent.clear();
+        createResultWriter(ResultFormat::Xml);
+
+        resultWriter->addResult("b.exe", 8, 0x1000, thirdResults);
+        resultWriter->addResult("a.exe", 4, 0x2000, secondResults);
+        resultWriter->addResult("a.exe", 4, 0x1000, firstResults);
+        resultWriter->finish();
+
+        EXPECT_EQ(fileContent, output);
+    }
+
+    TEST_F(ResultWriterFixture, finish_xmlMultipleProcesses_orderedByPidAndBaseAddress)
+    {
+        std::vector<Rule> results{{.ruleName = "rule", .ruleNamespace = "ns", .matches = {{"$a", 0}}}};
+        createResultWriter(ResultFormat::Xml);
+
+        resultWriter->addResult("b.exe", 8, 0x1000, results);
+        resultWriter->addResult("a.exe", 4, 0x2000, results);
+        resultWriter->addResult("a.exe", 4, 0x1000, results);
+        resultWriter->finish();
+
+        auto firstPosition = fileContent.find("position=\"4096\"");
+        auto secondPosition = fileContent.find("position=\"8192\"");
+        auto thirdPosition = fileContent.find("pid=\"8\"");
+        ASSERT_NE(thirdPosition, std::string::npos);
+        EXPECT_LT(firstPosition, secondPosition);
+        EXPECT_LT(secondPosition, thirdPosition);
+    }
+
+    TEST_F(ResultWriterFixture, addResult_concurrentThreads_everyResultWrittenOnce)
+    {
+        constexpr int numberOfThreads = 8;
+        constexpr int resultsPerThread = 1000;
+        std::vector<Rule> results{{.ruleName = "rule", .ruleNamespace = "ns", .matches = {{"$a", 0}}}};
+        createResultWriter(ResultFormat::Ndjson);
+
+        {
+            std::vector<std::jthread> threads;
+            for (int i = 0; i < numberOfThreads; i++)
+            {
+                threads.emplace_back(
+                    [this, &results, pid = i]()
+                    {
+                        for (int j = 0; j < resultsPerThread; j++)
+                        {
+                            resultWriter->addResult("a.exe", pid, j, results);
+                        }
+                    });
+            }
+        }
+        resultWriter->finish();
+
+        std::istringstream content(fileContent);
+        std::string line;
+        int numberOfLines = 0;
+        while (std::getline(content, line))
+        {
+            ASSERT_TRUE(line.starts_with("{\"process\":\"a.exe\"") && line.ends_with("]}]}"));
+            numberOfLines++;
+        }
+        EXPECT_EQ(numberOfLines, numberOfThreads * resultsPerThread);
+    }
+}
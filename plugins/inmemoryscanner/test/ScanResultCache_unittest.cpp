@@ -0,0 +1,68 @@
+#include <ScanResultCache.h>
+#include <gtest/gtest.h>
+#include <vmicore/os/PagingDefinitions.h>
+
+using VmiCore::addr_t;
+using VmiCore::MappedRegion;
+using VmiCore::PagingDefinitions::pageSizeInBytes;
+
+namespace InMemoryScanner
+{
+    class ScanResultCacheFixture : public testing::Test
+    {
+      protected:
+        addr_t firstBase = 0x7ff000000000;
+        addr_t secondBase = 0x7ff100000000;
+        std::vector<uint8_t> pageContent = std::vector<uint8_t>(pageSizeInBytes, 0x5A);
+        ScanResultCache cache{};
+    };
+
+    TEST_F(ScanResultCacheFixture, computeHash_sameContentAtDifferentBase_equalHashes)
+    {
+        auto firstHash = ScanResultCache::computeHash(firstBase, std::vector{MappedRegion(firstBase, pageContent)});
+        auto secondHash = ScanResultCache::computeHash(secondBase, std::vector{MappedRegion(secondBase, pageContent)});
+
+        EXPECT_EQ(firstHash, secondHash);
+    }
+
+    TEST_F(ScanResultCacheFixture, computeHash_sameContentDifferentLayout_differentHashes)
+    {
+        auto contiguousHash =
+            ScanResultCache::computeHash(firstBase, std::vector{MappedRegion(firstBase, pageContent)});
+        auto withHoleHash = ScanResultCache::computeHash(
+            firstBase, std::vector{MappedRegion(firstBase + pageSizeInBytes, pageContent)});
+
+        EXPECT_NE(contiguousHash, withHoleHash);
+    }
+
+    TEST_F(ScanResultCacheFixture, computeHash_differentContent_differentHashes)
+    {
+        auto otherContent = pageContent;
+        otherContent[pageSizeInBytes - 1] = 0;
+
+        auto firstHash = ScanResultCache::computeHash(firstBase, std::vector{MappedRegion(firstBase, pageContent)});
+        auto secondHash = ScanResultCache::computeHash(firstBase, std::vector{MappedRegion(firstBase, otherContent)});
+
+        EXPECT_NE(firstHash, secondHash);
+    }
+
+    TEST_F(ScanResultCacheFixture, find_unknownHash_nullopt)
+    {
+        EXPECT_FALSE(cache.find(ContentHash{.low = 1, .high = 2}, firstBase).has_value());
+    }
+
+    TEST_F(ScanResultCacheFixture, find_resultsInsertedForDifferentBase_matchPositionsRebased)
+    {
+        auto contentHash = ScanResultCache::computeHash(firstBase, std::vector{MappedRegion(firstBase, pageContent)});
+        cache.insert(contentHash,
+                     firstBase,
+                     {Rule{.ruleName = "rule", .ruleNamespace = "ns", .matches = {{"$a", int64_t(firstBase + 0x10)}}}});
+
+        auto results = cache.find(contentHash, secondBase);
+
+        auto expectedResults = std::vector<Rule>{
+            {.ruleName = "rule", .ruleNamespace = "ns", .matches = {{"$a", int64_t(secondBase + 0x10)}}}};
+        ASSERT_TRUE(results.has_value());
+        EXPECT_EQ(*results, expectedResults);
+    }
+}
@@ -0,0 +1,43 @@
+#include <ScanWorkerPool.h>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+namespace InMemoryScanner
+{
+    TEST(ScanWorkerPoolTest, waitForCompletion_multipleJobsSubmitted_allJobsProcessed)
+    {
+        constexpr int jobCount = 100;
+        std::atomic<int> processedJobs = 0;
+        ScanWorkerPool pool(4, 2);
+
+        for (int i = 0; i < jobCount; i++)
+        {
+            pool.submit([&processedJobs]() { processedJobs++; });
+        }
+        pool.waitForCompletion();
+
+        EXPECT_EQ(processedJobs, jobCount);
+    }
+
+    TEST(ScanWorkerPoolTest, destructor_jobsPending_pendingJobsProcessed)
+    {
+        constexpr int jobCount = 10;
+        std::atomic<int> processedJobs = 0;
+
+        {
+            ScanWorkerPool pool(1, jobCount);
+            for (int i = 0; i < jobCount; i++)
+            {
+                pool.submit([&processedJobs]() { processedJobs++; });
+            }
+        }
+
+        EXPECT_EQ(processedJobs, jobCount);
+    }
+
+    TEST(ScanWorkerPoolTest, constructor_noWorkers_throws)
+    {
+        EXPECT_THROW(ScanWorkerPool(0, 1), std::invalid_argument);
+    }
+}
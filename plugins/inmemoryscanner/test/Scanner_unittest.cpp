@@ -6,11 +6,13 @@
 #include <fmt/core.h>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <map>
 #include <vmicore/os/PagingDefinitions.h>
 #include <vmicore_test/io/mock_Logger.h>
 #include <vmicore_test/os/mock_MemoryRegionExtractor.h>
 #include <vmicore_test/os/mock_PageProtection.h>
 #include <vmicore_test/plugins/mock_PluginInterface.h>
+#include <vmicore_test/vmi/mock_IntrospectionAPI.h>
 #include <vmicore_test/vmi/mock_MemoryMapping.h>
 
 using testing::_;
@@ -23,8 +25,11 @@ using testing::Return;
 using testing::Unused;
 using VmiCore::ActiveProcessInformation;
 using VmiCore::addr_t;
+using VmiCore::FileSegment;
+using VmiCore::FrameRun;
 using VmiCore::MappedRegion;
 using VmiCore::MemoryRegion;
+using VmiCore::MockIntrospectionAPI;
 using VmiCore::MockLogger;
 using VmiCore::MockMemoryRegionExtractor;
 using VmiCore::MockPageProtection;
@@ -77,8 +82,8 @@ namespace InMemoryScanner
                                          testPid,
                                          0,
                                          "System.exe",
-                                         std::make_unique<std::string>("System.exe"),
-                                         std::make_unique<std::string>(""),
+                                         std::string("System.exe"),
+                                         std::string(""),
                                          std::move(m1),
                                          false}));
             auto m2 = std::make_unique<MockMemoryRegionExtractor>();
@@ -90,8 +95,8 @@ namespace InMemoryScanner
                                          processIdWithSharedBaseImageRegion,
                                          0,
                                          "SomeProcess.exe",
-                                         std::make_unique<std::string>("SomeProcess.exe"),
-                                         std::make_unique<std::string>(""),
+                                         std::string("SomeProcess.exe"),
+                                         std::string(""),
                                          std::move(m2),
                                          false}));
 
@@ -202,6 +207,52 @@ namespace InMemoryScanner
         return paddedRegion;
     }
 
+    std::vector<uint8_t> assembleFileContent(std::span<const FileSegment> segments, std::size_t fileSize)
+    {
+        std::vector<uint8_t> fileContent(fileSize, 0);
+        for (const auto& segment : segments)
+        {
+            auto segmentStart = std::next(fileContent.begin(), static_cast<std::ptrdiff_t>(segment.offset));
+            std::ranges::copy(segment.data, segmentStart);
+        }
+
+        return fileContent;
+    }
+
+    // Copies the given guest mappings, like the snapshot facility of VmiCore does
+    class FakeMemorySnapshot : public VmiCore::IMemorySnapshot
+    {
+      public:
+        FakeMemorySnapshot() = default;
+
+        FakeMemorySnapshot(MemoryRegion memoryRegion, std::span<const MappedRegion> guestMappings)
+        {
+            contents.reserve(guestMappings.size());
+            mappedRegions.reserve(guestMappings.size());
+            for (const auto& guestMapping : guestMappings)
+            {
+                auto& content = contents.emplace_back(guestMapping.asSpan().begin(), guestMapping.asSpan().end());
+                mappedRegions.emplace_back(guestMapping.guestBaseVA, content);
+            }
+            regions.push_back(VmiCore::SnapshotRegion{std::move(memoryRegion), mappedRegions});
+        }
+
+        [[nodiscard]] std::span<const VmiCore::SnapshotRegion> getRegions() const override
+        {
+            return regions;
+        }
+
+        [[nodiscard]] std::size_t size() const override
+        {
+            return 0;
+        }
+
+      private:
+        std::vector<std::vector<uint8_t>> contents;
+        std::vector<MappedRegion> mappedRegions;
+        std::vector<VmiCore::SnapshotRegion> regions;
+    };
+
     TEST_F(ScannerTestFixtureDumpingDisabled, scanProcess_smallMemoryRegion_originalReadMemoryRegionSize)
     {
         ON_CALL(*systemMemoryRegionExtractorRaw, extractAllMemoryRegions())
@@ -258,8 +309,8 @@ namespace InMemoryScanner
                                      pid,
                                      0,
                                      trimmedProcessName,
-                                     std::make_unique<std::string>(fullProcessName),
-                                     std::make_unique<std::string>(),
+                                     std::string(fullProcessName),
+                                     std::string(),
                                      std::move(memoryRegionExtractor),
                                      false});
         // Redefine default mock return because a new MemoryRegionExtractor mock has been created
@@ -282,7 +333,7 @@ namespace InMemoryScanner
         createMemoryMapping(dtb, startAddress, bytesToNumberOfPages(size), regionMappings);
 
         EXPECT_CALL(*pluginInterface,
-                    writeToFile(ContainsRegex(expectedFileNameWithPathRegEx), An<const std::vector<uint8_t>&>()));
+                    writeSegmentsToFile(ContainsRegex(expectedFileNameWithPathRegEx), _, _));
         EXPECT_NO_THROW(scanner->scanProcess(processWithLongName));
     }
 
@@ -300,7 +351,7 @@ namespace InMemoryScanner
         auto expectedFileNameWithPathRegEx = "^" + (dumpedRegionsPath / expectedFileNameRegEx).string() + "$";
 
         EXPECT_CALL(*pluginInterface,
-                    writeToFile(ContainsRegex(expectedFileNameWithPathRegEx), An<const std::vector<uint8_t>&>()));
+                    writeSegmentsToFile(ContainsRegex(expectedFileNameWithPathRegEx), _, _));
         EXPECT_NO_THROW(scanner->scanProcess(processWithShortName));
     }
 
@@ -320,15 +371,15 @@ namespace InMemoryScanner
                                      testPid,
                                      0,
                                      "System.exe",
-                                     std::make_unique<std::string>("System.exe"),
-                                     std::make_unique<std::string>(""),
+                                     std::string("System.exe"),
+                                     std::string(""),
                                      std::move(memoryRegionExtractor),
                                      false});
         ON_CALL(*pluginInterface, getRunningProcesses())
             .WillByDefault(
                 [&processInfo]()
                 {
-                    return std::make_unique<std::vector<std::shared_ptr<const ActiveProcessInformation>>>(
+                    return std::make_shared<const std::vector<std::shared_ptr<const ActiveProcessInformation>>>(
                         YR_MAX_THREADS + 5, processInfo);
                 });
         ON_CALL(*memoryRegionExtractorRaw, extractAllMemoryRegions())
@@ -362,8 +413,8 @@ namespace InMemoryScanner
                                      pid,
                                      0,
                                      "",
-                                     std::make_unique<std::string>(fullProcessName),
-                                     std::make_unique<std::string>(""),
+                                     std::string(fullProcessName),
+                                     std::string(""),
                                      std::move(memoryRegionExtractor),
                                      false});
         auto expectedFileName = inMemoryDumpsPath / "MemoryRegionInformation.json";
@@ -382,7 +433,7 @@ namespace InMemoryScanner
             .WillByDefault(
                 [&processInfo]()
                 {
-                    return std::make_unique<std::vector<std::shared_ptr<const ActiveProcessInformation>>>(1,
+                    return std::make_shared<const std::vector<std::shared_ptr<const ActiveProcessInformation>>>(1,
                                                                                                           processInfo);
                 });
         // Redefine default mock return because a new MemoryRegionExtractor mock has been created
@@ -417,8 +468,8 @@ namespace InMemoryScanner
                                                                                 pid,
                                                                                 0,
                                                                                 "",
-                                                                                std::make_unique<std::string>(""),
-                                                                                std::make_unique<std::string>(""),
+                                                                                std::string(""),
+                                                                                std::string(""),
                                                                                 std::move(memoryRegionExtractor),
                                                                                 false});
         // Layout of complex region: 1 page, followed by 2 unmapped pages, followed by 2 pages
@@ -441,7 +492,316 @@ namespace InMemoryScanner
         auto paddingPage = std::vector<uint8_t>(pageSizeInBytes, 0);
         auto expectedPaddedRegion = constructPaddedRegion({testPageContent, paddingPage, twoPageRegionContent});
 
-        EXPECT_CALL(*pluginInterface, writeToFile(_, expectedPaddedRegion)).Times(1);
+        std::vector<uint8_t> dumpedRegion;
+        EXPECT_CALL(*pluginInterface, writeSegmentsToFile(_, _, _))
+            .WillOnce([&dumpedRegion](Unused, std::span<const FileSegment> segments, std::size_t fileSize)
+                      { dumpedRegion = assembleFileContent(segments, fileSize); });
         ASSERT_NO_THROW(scanner->scanProcess(processInfo));
+
+        EXPECT_EQ(dumpedRegion, expectedPaddedRegion);
+    }
+
+    TEST_F(ScannerTestFixtureDumpingDisabled, scanTerminatedProcess_snapshotTaken_snapshotScannedInsteadOfGuestMemory)
+    {
+        auto guestPage = std::vector<uint8_t>(pageSizeInBytes, 0xAB);
+        std::vector<MappedRegion> guestMappings{{startAddress, guestPage}};
+        EXPECT_CALL(*pluginInterface, snapshotProcessMemory(_, _))
+            .WillOnce(
+                [startAddress = startAddress, size = size, &guestMappings](Unused, Unused)
+                {
+                    return std::make_unique<FakeMemorySnapshot>(
+                        MemoryRegion{
+                            startAddress, size, "", std::make_unique<MockPageProtection>(), false, false, false},
+                        guestMappings);
+                });
+        EXPECT_CALL(*pluginInterface, mapProcessMemoryRegion(_, _, _)).Times(0);
+        std::vector<uint8_t> scannedContent;
+        auto yara = std::make_unique<MockYaraInterface>();
+        EXPECT_CALL(*yara, scanMemory(_))
+            .WillOnce(
+                [&scannedContent](std::span<const MappedRegion> mappedRegions)
+                {
+                    for (const auto& mappedRegion : mappedRegions)
+                    {
+                        auto content = mappedRegion.asSpan();
+                        scannedContent.insert(scannedContent.end(), content.begin(), content.end());
+                    }
+                    return std::vector<Rule>{};
+                });
+        scanner.emplace(
+            pluginInterface.get(), configuration, std::move(yara), std::make_unique<NiceMock<MockDumping>>());
+
+        ASSERT_NO_THROW(scanner->scanTerminatedProcess(getProcessInfoFromRunningProcesses(testPid)));
+        // The guest is resumed after the callback, so its memory may be reused right away
+        std::ranges::fill(guestPage, 0);
+        scanner->waitForPendingScans();
+
+        EXPECT_EQ(scannedContent, std::vector<uint8_t>(pageSizeInBytes, 0xAB));
+    }
+
+    TEST_F(ScannerTestFixtureDumpingDisabled, scanTerminatedProcess_snapshotExceedsLimit_guestMemoryScannedInPlace)
+    {
+        ON_CALL(*systemMemoryRegionExtractorRaw, extractAllMemoryRegions())
+            .WillByDefault(
+                [startAddress = startAddress, size = size]()
+                {
+                    auto memoryRegions = std::make_unique<std::vector<MemoryRegion>>();
+                    memoryRegions->emplace_back(
+                        startAddress, size, "", std::make_unique<MockPageProtection>(), false, false, false);
+                    return memoryRegions;
+                });
+        EXPECT_CALL(*pluginInterface, snapshotProcessMemory(_, _))
+            .WillOnce([](Unused, Unused) -> std::unique_ptr<VmiCore::IMemorySnapshot>
+                      { throw std::length_error("Exceeds snapshot memory limit"); });
+        EXPECT_CALL(*pluginInterface, mapProcessMemoryRegion(startAddress, testDtb, 1));
+        std::vector<uint8_t> scannedContent;
+        auto yara = std::make_unique<MockYaraInterface>();
+        EXPECT_CALL(*yara, scanMemory(_))
+            .WillOnce(
+                [&scannedContent](std::span<const MappedRegion> mappedRegions)
+                {
+                    for (const auto& mappedRegion : mappedRegions)
+                    {
+                        auto content = mappedRegion.asSpan();
+                        scannedContent.insert(scannedContent.end(), content.begin(), content.end());
+                    }
+                    return std::vector<Rule>{};
+                });
+        scanner.emplace(
+            pluginInterface.get(), configuration, std::move(yara), std::make_unique<NiceMock<MockDumping>>());
+        EXPECT_CALL(*pluginInterface, sendErrorEvent(_)).Times(0);
+
+        ASSERT_NO_THROW(scanner->scanTerminatedProcess(getProcessInfoFromRunningProcesses(testPid)));
+
+        EXPECT_EQ(scannedContent, testPageContent);
+    }
+
+    TEST_F(ScannerTestFixtureDumpingDisabled, scanTerminatedProcess_sharedMemoryRegion_excludedFromSnapshot)
+    {
+        std::function<bool(const MemoryRegion&)> snapshotFilter;
+        EXPECT_CALL(*pluginInterface, snapshotProcessMemory(_, _))
+            .WillOnce(
+                [&snapshotFilter](Unused, const std::function<bool(const MemoryRegion&)>& filter)
+                {
+                    snapshotFilter = filter;
+                    return std::make_unique<FakeMemorySnapshot>();
+                });
+
+        scanner->scanTerminatedProcess(getProcessInfoFromRunningProcesses(testPid));
+        scanner->waitForPendingScans();
+
+        ASSERT_TRUE(snapshotFilter);
+        EXPECT_FALSE(snapshotFilter(
+            MemoryRegion{startAddress, size, "", std::make_unique<MockPageProtection>(), true, false, false}));
+        EXPECT_TRUE(snapshotFilter(
+            MemoryRegion{startAddress, size, "", std::make_unique<MockPageProtection>(), false, false, false}));
+    }
+
+    TEST_F(ScannerTestFixtureDumpingDisabled, scanProcess_identicalSharedRegionScannedBefore_cachedResultReused)
+    {
+        ON_CALL(*configuration, isScanAllRegionsActivated()).WillByDefault(Return(true));
+        auto sharedRegions = [startAddress = startAddress, size = size]()
+        {
+            auto memoryRegions = std::make_unique<std::vector<MemoryRegion>>();
+            memoryRegions->emplace_back(
+                startAddress, size, "shared.dll", std::make_unique<MockPageProtection>(), true, false, false);
+            return memoryRegions;
+        };
+        ON_CALL(*systemMemoryRegionExtractorRaw, extractAllMemoryRegions()).WillByDefault(sharedRegions);
+        ON_CALL(*sharedBaseImageMemoryRegionExtractorRaw, extractAllMemoryRegions()).WillByDefault(sharedRegions);
+        auto yara = std::make_unique<MockYaraInterface>();
+        EXPECT_CALL(*yara, scanMemory(_))
+            .WillOnce(Return(std::vector<Rule>{
+                {.ruleName = "rule", .ruleNamespace = "ns", .matches = {{"$a", int64_t(startAddress)}}}}));
+        scanner.emplace(
+            pluginInterface.get(), configuration, std::move(yara), std::make_unique<NiceMock<MockDumping>>());
+
+        EXPECT_CALL(*pluginInterface, sendInMemDetectionEvent(std::string_view("rule"))).Times(2);
+        ASSERT_NO_THROW(scanner->scanProcess(getProcessInfoFromRunningProcesses(testPid)));
+        ASSERT_NO_THROW(scanner->scanProcess(getProcessInfoFromRunningProcesses(processIdWithSharedBaseImageRegion)));
+    }
+
+    TEST_F(ScannerTestFixtureDumpingDisabled, scanAllProcesses_regionsBackedBySameFrames_scannedOnceAndReportedForAll)
+    {
+        ON_CALL(*configuration, isFrameDeduplicationActivated()).WillByDefault(Return(true));
+        ON_CALL(*pluginInterface, getRunningProcesses())
+            .WillByDefault(
+                Return(std::make_shared<std::vector<std::shared_ptr<const ActiveProcessInformation>>>(
+                    *runningProcesses)));
+        auto privateRegions = [startAddress = startAddress, size = size]()
+        {
+            auto memoryRegions = std::make_unique<std::vector<MemoryRegion>>();
+            memoryRegions->emplace_back(
+                startAddress, size, "", std::make_unique<MockPageProtection>(), false, false, false);
+            return memoryRegions;
+        };
+        ON_CALL(*systemMemoryRegionExtractorRaw, extractAllMemoryRegions()).WillByDefault(privateRegions);
+        ON_CALL(*sharedBaseImageMemoryRegionExtractorRaw, extractAllMemoryRegions()).WillByDefault(privateRegions);
+        auto introspectionAPI = std::make_shared<MockIntrospectionAPI>();
+        ON_CALL(*introspectionAPI, getFrameRuns(startAddress, _, bytesToNumberOfPages(size)))
+            .WillByDefault(
+                Return(std::vector<FrameRun>{{.guestBaseVA = startAddress, .firstGfn = 0x42, .num_pages = 1}}));
+        ON_CALL(*pluginInterface, getIntrospectionAPI()).WillByDefault(Return(introspectionAPI));
+        auto yara = std::make_unique<MockYaraInterface>();
+        EXPECT_CALL(*yara, scanMemory(_))
+            .WillOnce(Return(std::vector<Rule>{
+                {.ruleName = "rule", .ruleNamespace = "ns", .matches = {{"$a", int64_t(startAddress)}}}}));
+        scanner.emplace(
+            pluginInterface.get(), configuration, std::move(yara), std::make_unique<NiceMock<MockDumping>>());
+
+        EXPECT_CALL(*pluginInterface, sendInMemDetectionEvent(std::string_view("rule"))).Times(2);
+        ASSERT_NO_THROW(scanner->scanAllProcesses());
+    }
+
+    TEST_F(ScannerTestFixtureDumpingDisabled, scanAllProcesses_sharedFramesAtDifferentBases_dumpedAtOwnBases)
+    {
+        const addr_t otherStartAddress = startAddress - 0x100000;
+        ON_CALL(*configuration, isFrameDeduplicationActivated()).WillByDefault(Return(true));
+        ON_CALL(*configuration, isDumpingMemoryActivated()).WillByDefault(Return(true));
+        ON_CALL(*pluginInterface, getRunningProcesses())
+            .WillByDefault(
+                Return(std::make_shared<std::vector<std::shared_ptr<const ActiveProcessInformation>>>(
+                    *runningProcesses)));
+        auto regionsAt = [size = size](addr_t base)
+        {
+            return [base, size]()
+            {
+                auto memoryRegions = std::make_unique<std::vector<MemoryRegion>>();
+                memoryRegions->emplace_back(
+                    base, size, "", std::make_unique<MockPageProtection>(), false, false, false);
+                return memoryRegions;
+            };
+        };
+        ON_CALL(*systemMemoryRegionExtractorRaw, extractAllMemoryRegions()).WillByDefault(regionsAt(startAddress));
+        ON_CALL(*sharedBaseImageMemoryRegionExtractorRaw, extractAllMemoryRegions())
+            .WillByDefault(regionsAt(otherStartAddress));
+        auto introspectionAPI = std::make_shared<MockIntrospectionAPI>();
+        for (auto base : {startAddress, otherStartAddress})
+        {
+            ON_CALL(*introspectionAPI, getFrameRuns(base, _, bytesToNumberOfPages(size)))
+                .WillByDefault(Return(std::vector<FrameRun>{{.guestBaseVA = base, .firstGfn = 0x42, .num_pages = 1}}));
+        }
+        ON_CALL(*pluginInterface, getIntrospectionAPI()).WillByDefault(Return(introspectionAPI));
+        std::map<pid_t, std::pair<addr_t, std::vector<addr_t>>> dumpedRegions;
+        auto dumping = std::make_unique<MockDumping>();
+        EXPECT_CALL(*dumping, dumpMemoryRegion(_, _, _, _))
+            .Times(2)
+            .WillRepeatedly(
+                [&dumpedRegions](Unused,
+                                 pid_t pid,
+                                 const MemoryRegion& memoryRegionDescriptor,
+                                 std::span<const MappedRegion> mappedRegions)
+                {
+                    auto& [regionBase, mappingBases] = dumpedRegions[pid];
+                    regionBase = memoryRegionDescriptor.base;
+                    for (const auto& mappedRegion : mappedRegions)
+                    {
+                        mappingBases.push_back(mappedRegion.guestBaseVA);
+                    }
+                });
+        scanner.emplace(
+            pluginInterface.get(), configuration, std::make_unique<NiceMock<MockYaraInterface>>(), std::move(dumping));
+
+        ASSERT_NO_THROW(scanner->scanAllProcesses());
+
+        EXPECT_EQ(dumpedRegions[testPid], std::make_pair(startAddress, std::vector<addr_t>{startAddress}));
+        EXPECT_EQ(dumpedRegions[processIdWithSharedBaseImageRegion],
+                  std::make_pair(otherStartAddress, std::vector<addr_t>{otherStartAddress}));
+    }
+
+    TEST_F(ScannerTestFixtureDumpingDisabled, scanAllProcesses_regionLargerThanChunkSize_chunksScannedAndMerged)
+    {
+        constexpr std::size_t regionPages = 5;
+        constexpr std::size_t chunkPages = 2;
+        ON_CALL(*configuration, getScanChunkSize()).WillByDefault(Return(chunkPages * pageSizeInBytes));
+        ON_CALL(*pluginInterface, getRunningProcesses())
+            .WillByDefault(Return(std::make_shared<std::vector<std::shared_ptr<const ActiveProcessInformation>>>(
+                1, getProcessInfoFromRunningProcesses(testPid))));
+        ON_CALL(*systemMemoryRegionExtractorRaw, extractAllMemoryRegions())
+            .WillByDefault(
+                [startAddress = startAddress]()
+                {
+                    auto memoryRegions = std::make_unique<std::vector<MemoryRegion>>();
+                    memoryRegions->emplace_back(startAddress,
+                                                regionPages * pageSizeInBytes,
+                                                "",
+                                                std::make_unique<MockPageProtection>(),
+                                                false,
+                                                false,
+                                                false);
+                    return memoryRegions;
+                });
+        // Chunks overlap by one page, the last chunk is truncated at the region end
+        std::vector<uint8_t> chunkContent(3 * pageSizeInBytes, 1);
+        std::vector<MappedRegion> firstChunk{MappedRegion(startAddress, chunkContent)};
+        std::vector<MappedRegion> secondChunk{MappedRegion(startAddress + 2 * pageSizeInBytes, chunkContent)};
+        std::vector<MappedRegion> lastChunk{
+            MappedRegion(startAddress + 4 * pageSizeInBytes, std::span(chunkContent).first(pageSizeInBytes))};
+        createMemoryMapping(testDtb, startAddress, 3, firstChunk);
+        createMemoryMapping(testDtb, startAddress + 2 * pageSizeInBytes, 3, secondChunk);
+        createMemoryMapping(testDtb, startAddress + 4 * pageSizeInBytes, 1, lastChunk);
+        // A match inside of the overlap between the first and second chunk is found twice
+        auto overlapMatch = Match{"$a", int64_t(startAddress + 2 * pageSizeInBytes + 0x10)};
+        auto yara = std::make_unique<MockYaraInterface>();
+        ON_CALL(*yara, getMaximumMatchLength()).WillByDefault(Return(1));
+        EXPECT_CALL(*yara, scanMemory(_))
+            .Times(3)
+            .WillRepeatedly(
+                [overlapMatch](std::span<const MappedRegion> mappedRegions)
+                {
+                    auto chunkEnd = mappedRegions.back().guestBaseVA + mappedRegions.back().asSpan().size();
+                    if (mappedRegions.front().guestBaseVA <= static_cast<addr_t>(overlapMatch.position) &&
+                        static_cast<addr_t>(overlapMatch.position) < chunkEnd)
+                    {
+                        return std::vector<Rule>{
+                            {.ruleName = "rule", .ruleNamespace = "ns", .matches = {overlapMatch}}};
+                    }
+                    return std::vector<Rule>{};
+                });
+        scanner.emplace(
+            pluginInterface.get(), configuration, std::move(yara), std::make_unique<NiceMock<MockDumping>>());
+
+        EXPECT_CALL(*pluginInterface, sendInMemDetectionEvent(std::string_view("rule"))).Times(1);
+        ASSERT_NO_THROW(scanner->scanAllProcesses());
+    }
+
+    TEST_F(ScannerTestFixtureDumpingDisabled, scanAllProcesses_reportingChunkedRegionFails_errorEventSent)
+    {
+        ON_CALL(*configuration, getScanChunkSize()).WillByDefault(Return(2 * pageSizeInBytes));
+        ON_CALL(*pluginInterface, getRunningProcesses())
+            .WillByDefault(Return(std::make_shared<std::vector<std::shared_ptr<const ActiveProcessInformation>>>(
+                1, getProcessInfoFromRunningProcesses(testPid))));
+        ON_CALL(*systemMemoryRegionExtractorRaw, extractAllMemoryRegions())
+            .WillByDefault(
+                [startAddress = startAddress]()
+                {
+                    auto memoryRegions = std::make_unique<std::vector<MemoryRegion>>();
+                    memoryRegions->emplace_back(startAddress,
+                                                3 * pageSizeInBytes,
+                                                "",
+                                                std::make_unique<MockPageProtection>(),
+                                                false,
+                                                false,
+                                                false);
+                    return memoryRegions;
+                });
+        std::vector<uint8_t> chunkContent(3 * pageSizeInBytes, 1);
+        std::vector<MappedRegion> firstChunk{MappedRegion(startAddress, chunkContent)};
+        std::vector<MappedRegion> lastChunk{
+            MappedRegion(startAddress + 2 * pageSizeInBytes, std::span(chunkContent).first(pageSizeInBytes))};
+        createMemoryMapping(testDtb, startAddress, 3, firstChunk);
+        createMemoryMapping(testDtb, startAddress + 2 * pageSizeInBytes, 1, lastChunk);
+        auto yara = std::make_unique<NiceMock<MockYaraInterface>>();
+        ON_CALL(*yara, getMaximumMatchLength()).WillByDefault(Return(1));
+        ON_CALL(*yara, scanMemory(_))
+            .WillByDefault(Return(std::vector<Rule>{
+                {.ruleName = "rule", .ruleNamespace = "ns", .matches = {{"$a", int64_t(startAddress)}}}}));
+        scanner.emplace(
+            pluginInterface.get(), configuration, std::move(yara), std::make_unique<NiceMock<MockDumping>>());
+
+        EXPECT_CALL(*pluginInterface, sendInMemDetectionEvent(_))
+            .WillOnce([](Unused) { throw std::runtime_error("Event stream closed"); });
+        EXPECT_CALL(*pluginInterface, sendErrorEvent(std::string_view("Event stream closed"))).Times(1);
+        ASSERT_NO_THROW(scanner->scanAllProcesses());
     }
 }
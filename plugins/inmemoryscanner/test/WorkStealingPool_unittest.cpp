@@ -0,0 +1,111 @@
+#include <WorkStealingPool.h>
+#include <algorithm>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+
+namespace InMemoryScanner
+{
+    TEST(WorkStealingPoolTest, run_multipleJobs_allJobsProcessed)
+    {
+        constexpr std::size_t jobCount = 100;
+        std::atomic<std::size_t> processedJobs = 0;
+        std::vector<WorkStealingPool::Job> jobs;
+        for (std::size_t i = 0; i < jobCount; i++)
+        {
+            jobs.push_back({.cost = i, .work = [&processedJobs]() { processedJobs++; }});
+        }
+
+        WorkStealingPool(4).run(std::move(jobs));
+
+        EXPECT_EQ(processedJobs, jobCount);
+    }
+
+    TEST(WorkStealingPoolTest, run_singleWorker_jobsProcessedLargestFirst)
+    {
+        std::vector<std::size_t> processingOrder;
+        std::vector<WorkStealingPool::Job> jobs;
+        for (std::size_t cost : {3, 10, 1, 7})
+        {
+            jobs.push_back({.cost = cost, .work = [&processingOrder, cost]() { processingOrder.push_back(cost); }});
+        }
+
+        WorkStealingPool(1).run(std::move(jobs));
+
+        EXPECT_EQ(processingOrder, (std::vector<std::size_t>{10, 7, 3, 1}));
+    }
+
+    TEST(WorkStealingPoolTest, run_moreJobsThanWorkers_concurrencyBoundedByWorkerCount)
+    {
+        constexpr std::size_t workerCount = 2;
+        std::atomic<std::size_t> runningJobs = 0;
+        std::atomic<std::size_t> maxRunningJobs = 0;
+        std::vector<WorkStealingPool::Job> jobs;
+        for (std::size_t i = 0; i < 16; i++)
+        {
+            jobs.push_back({.cost = 1,
+                            .work =
+                                [&runningJobs, &maxRunningJobs]()
+                                {
+                                    auto current = ++runningJobs;
+                                    auto previousMax = maxRunningJobs.load();
+                                    while (previousMax < current &&
+                                           !maxRunningJobs.compare_exchange_weak(previousMax, current))
+                                    {
+                                    }
+                                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                                    runningJobs--;
+                                }});
+        }
+
+        WorkStealingPool(workerCount).run(std::move(jobs));
+
+        EXPECT_LE(maxRunningJobs, workerCount);
+    }
+
+    TEST(WorkStealingPoolTest, run_oneWorkerBlockedByExpensiveJob_remainingJobsStolen)
+    {
+        std::atomic<bool> cheapJobsDone = false;
+        std::atomic<std::size_t> processedCheapJobs = 0;
+        constexpr std::size_t cheapJobCount = 8;
+        std::vector<WorkStealingPool::Job> jobs;
+        // The expensive job only finishes once all cheap jobs have been processed, which requires the other worker to
+        // steal the cheap jobs dealt to the blocked worker
+        jobs.push_back({.cost = 100,
+                        .work =
+                            [&cheapJobsDone]()
+                            {
+                                while (!cheapJobsDone)
+                                {
+                                    std::this_thread::yield();
+                                }
+                            }});
+        for (std::size_t i = 0; i < cheapJobCount; i++)
+        {
+            jobs.push_back({.cost = 1,
+                            .work =
+                                [&processedCheapJobs, &cheapJobsDone]()
+                                {
+                                    if (++processedCheapJobs == cheapJobCount)
+                                    {
+                                        cheapJobsDone = true;
+                                    }
+                                }});
+        }
+
+        WorkStealingPool(2).run(std::move(jobs));
+
+        EXPECT_EQ(processedCheapJobs, cheapJobCount);
+    }
+
+    TEST(WorkStealingPoolTest, run_noJobs_returnsImmediately)
+    {
+        EXPECT_NO_THROW(WorkStealingPool(4).run({}));
+    }
+
+    TEST(WorkStealingPoolTest, constructor_noWorkers_throws)
+    {
+        EXPECT_THROW(WorkStealingPool(0), std::invalid_argument);
+    }
+}
@@ -3,6 +3,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <string_view>
+#include <thread>
 
 using testing::UnorderedElementsAre;
 using VmiCore::PagingDefinitions::pageSizeInBytes;
@@ -63,7 +64,7 @@ namespace InMemoryScanner
                                 all of them
                         }
                     )";
-        auto yaraInterface = YaraInterface(compileYaraRules(rules), 0);
+        auto yaraInterface = YaraInterface(compileYaraRules(rules), 0, false);
         auto subRegion1 = constructPageWithContent("ABCD");
         std::vector<VmiCore::MappedRegion> memoryRegions{{0x0, subRegion1}};
 
@@ -84,7 +85,7 @@ namespace InMemoryScanner
                                 all of them
                         }
                     )";
-        auto yaraInterface = YaraInterface(compileYaraRules(rules), 0);
+        auto yaraInterface = YaraInterface(compileYaraRules(rules), 0, false);
         auto subRegion1 = constructPageWithContent("ABCD", true);
         auto subRegion2 = constructPageWithContent("DCBA", false);
         std::vector<VmiCore::MappedRegion> memoryRegions{{0x0, subRegion1}, {pageSizeInBytes, subRegion2}};
@@ -107,7 +108,7 @@ namespace InMemoryScanner
                                 all of them
                         }
                     )";
-        auto yaraInterface = YaraInterface(compileYaraRules(rules), 0);
+        auto yaraInterface = YaraInterface(compileYaraRules(rules), 0, false);
         auto subRegion1 = constructPageWithContent("ABCD");
         auto subRegion2 = constructPageWithContent("DCBA");
         std::vector<VmiCore::MappedRegion> memoryRegion1{{0x0, subRegion1}};
@@ -133,7 +134,7 @@ namespace InMemoryScanner
                                 all of them
                         }
                     )";
-        auto yaraInterface = YaraInterface(compileYaraRules(rules), 0);
+        auto yaraInterface = YaraInterface(compileYaraRules(rules), 0, false);
         auto subRegion1 = constructPageWithContent("ABCD");
         auto subRegion2 = constructPageWithContent("DCBA");
         std::vector<VmiCore::MappedRegion> memoryRegions{{0x0, subRegion1}, {4 * pageSizeInBytes, subRegion2}};
@@ -168,7 +169,7 @@ namespace InMemoryScanner
                                 all of them
                         }
                     )";
-        auto yaraInterface = YaraInterface(compileYaraRules(rules), 0);
+        auto yaraInterface = YaraInterface(compileYaraRules(rules), 0, false);
         auto subRegion1 = constructPageWithContent("ABCD");
         auto subRegion2 = constructPageWithContent("DCBA");
         auto subRegion3 = constructPageWithContent("EFGH");
@@ -183,4 +184,170 @@ namespace InMemoryScanner
         ASSERT_EQ(matches.size(), 2);
         EXPECT_THAT(matches, UnorderedElementsAre(expectedMatch1, expectedMatch2));
     }
+
+    TEST(YaraTest, getMaximumMatchLength_onlyShortStrings_regexScanLimit)
+    {
+        auto* rules = R"(
+                        rule testRule
+                        {
+                            strings:
+                                $test = "ABCD"
+                                $test2 = /AB.*CD/
+
+                            condition:
+                                any of them
+                        }
+                    )";
+        auto yaraInterface = YaraInterface(compileYaraRules(rules), 0, false);
+
+        EXPECT_EQ(yaraInterface.getMaximumMatchLength(), YR_RE_SCAN_LIMIT);
+    }
+
+    TEST(YaraTest, getMaximumMatchLength_stringLongerThanRegexScanLimit_lengthOfLongestString)
+    {
+        auto longString = std::string(YR_RE_SCAN_LIMIT + 1, 'A');
+        auto rules = fmt::format("rule testRule {{ strings: $test = \"{}\" condition: all of them }}", longString);
+        auto yaraInterface = YaraInterface(compileYaraRules(rules), 0, false);
+
+        EXPECT_EQ(yaraInterface.getMaximumMatchLength(), longString.size());
+    }
+
+    TEST(YaraTest, scanMemory_subsequentScanWithoutMatch_noMatchesOfPreviousScan)
+    {
+        auto* rules = R"(
+                        rule testRule
+                        {
+                            strings:
+                                $test = "ABCD"
+
+                            condition:
+                                all of them
+                        }
+                    )";
+        auto yaraInterface = YaraInterface(compileYaraRules(rules), 0, false);
+        auto matchingPage = constructPageWithContent("ABCD");
+        auto nonMatchingPage = constructPageWithContent("DCBA");
+        std::vector<VmiCore::MappedRegion> matchingRegion{{0x0, matchingPage}};
+        std::vector<VmiCore::MappedRegion> nonMatchingRegion{{0x0, nonMatchingPage}};
+
+        auto matches1 = yaraInterface.scanMemory(matchingRegion);
+        auto matches2 = yaraInterface.scanMemory(nonMatchingRegion);
+
+        EXPECT_EQ(matches1.size(), 1);
+        EXPECT_EQ(matches2.size(), 0);
+    }
+
+    TEST(YaraTest, scanMemory_concurrentScans_allMatch)
+    {
+        constexpr std::size_t threadCount = 8;
+        auto* rules = R"(
+                        rule testRule
+                        {
+                            strings:
+                                $test = "ABCD"
+
+                            condition:
+                                all of them
+                        }
+                    )";
+        auto yaraInterface = YaraInterface(compileYaraRules(rules), 0, false);
+        auto page = constructPageWithContent("ABCD");
+        std::vector<VmiCore::MappedRegion> memoryRegions{{0x0, page}};
+        std::vector<std::size_t> matchCounts(threadCount);
+
+        {
+            std::vector<std::jthread> threads;
+            for (std::size_t i = 0; i < threadCount; i++)
+            {
+                threads.emplace_back(
+                    [&yaraInterface, &memoryRegions, &matchCount = matchCounts[i]]()
+                    {
+                        for (int scan = 0; scan < 100; scan++)
+                        {
+                            matchCount += yaraInterface.scanMemory(memoryRegions).size();
+                        }
+                    });
+            }
+        }
+
+        EXPECT_THAT(matchCounts, testing::Each(100));
+    }
+
+    TEST(YaraTest, scanMemory_literalPrefilterActive_sameMatchesAsUnfilteredScan)
+    {
+        auto* rules = R"(
+                        rule asciiRule
+                        {
+                            strings:
+                                $test = "ABCD"
+                                $test2 = { 44 43 42 41 }
+
+                            condition:
+                                all of them
+                        }
+
+                        rule modifierRule
+                        {
+                            strings:
+                                $nocase = "needle" nocase
+                                $wide = "wide" wide ascii
+
+                            condition:
+                                any of them
+                        }
+                    )";
+        auto rulesFile = compileYaraRules(rules);
+        auto filteredYaraInterface = YaraInterface(rulesFile, 0, true);
+        auto unfilteredYaraInterface = YaraInterface(rulesFile, 0, false);
+        auto benignPage = constructPageWithContent("benign");
+        auto asciiPage = constructPageWithContent("ABCD", true);
+        auto hexPage = constructPageWithContent("DCBA");
+        auto nocasePage = constructPageWithContent("NeEdLe");
+        auto widePage = constructPageWithContent(std::string("w\0i\0d\0e\0", 8), true);
+        auto partialPage = constructPageWithContent("ABC", true);
+        std::vector<std::vector<VmiCore::MappedRegion>> memoryRegions{
+            {{0x0, benignPage}},
+            {{0x0, asciiPage}},
+            {{0x0, asciiPage}, {pageSizeInBytes, hexPage}},
+            {{0x0, benignPage}, {pageSizeInBytes, nocasePage}},
+            {{0x0, widePage}},
+            {{0x0, partialPage}, {pageSizeInBytes, benignPage}}};
+
+        ASSERT_TRUE(filteredYaraInterface.isLiteralPrefilterActive());
+        for (const auto& memoryRegion : memoryRegions)
+        {
+            EXPECT_THAT(filteredYaraInterface.scanMemory(memoryRegion),
+                        testing::UnorderedElementsAreArray(unfilteredYaraInterface.scanMemory(memoryRegion)));
+        }
+    }
+
+    TEST(YaraTest, constructor_rulesNotRequiringLiterals_literalPrefilterInactive)
+    {
+        auto* regexRules = R"(
+                        rule testRule
+                        {
+                            strings:
+                                $test = /AB.*CD/
+
+                            condition:
+                                any of them
+                        }
+                    )";
+        auto* stringlessRules = R"(
+                        rule testRule
+                        {
+                            strings:
+                                $test = "ABCD"
+
+                            condition:
+                                $test or uint8(0) == 0x41
+                        }
+                    )";
+
+        auto regexYaraInterface = YaraInterface(compileYaraRules(regexRules), 0, true);
+        auto stringlessYaraInterface = YaraInterface(compileYaraRules(stringlessRules), 0, true);
+
+        EXPECT_FALSE(regexYaraInterface.isLiteralPrefilterActive());
+        EXPECT_FALSE(stringlessYaraInterface.isLiteralPrefilterActive());
+    }
 }
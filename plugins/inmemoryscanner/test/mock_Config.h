@@ -15,6 +15,13 @@ namespace InMemoryScanner
         MOCK_METHOD(bool, isProcessIgnored, (const std::string& processName), (const, override));
         MOCK_METHOD(bool, isScanAllRegionsActivated, (), (const, override));
         MOCK_METHOD(bool, isDumpingMemoryActivated, (), (const, override));
+        MOCK_METHOD(bool, isDumpContainerActivated, (), (const, override));
+        MOCK_METHOD(int, getDumpCompressionLevel, (), (const, override));
+        MOCK_METHOD(std::size_t, getDumpCompressionThreads, (), (const, override));
+        MOCK_METHOD(bool, isFrameDeduplicationActivated, (), (const, override));
+        MOCK_METHOD(std::size_t, getScanChunkSize, (), (const, override));
+        MOCK_METHOD(ResultFormat, getResultFormat, (), (const, override));
+        MOCK_METHOD(bool, isLiteralPrefilterActivated, (), (const, override));
         MOCK_METHOD(void, overrideDumpMemoryFlag, (bool value), (override));
     };
 }
@@ -13,9 +13,9 @@ namespace InMemoryScanner
                     (const std::string& processName,
                      pid_t pid,
                      const VmiCore::MemoryRegion& memoryRegionDescriptor,
-                     const std::vector<uint8_t>& data),
+                     std::span<const VmiCore::MappedRegion> mappedRegions),
                     (override));
 
-        MOCK_METHOD(std::vector<std::string>, getAllMemoryRegionInformation, (), (override));
+        MOCK_METHOD(void, saveOutput, (), (override));
     };
 }
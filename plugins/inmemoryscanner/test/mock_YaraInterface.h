@@ -9,5 +9,6 @@ namespace InMemoryScanner
     {
       public:
         MOCK_METHOD(std::vector<Rule>, scanMemory, (std::span<const VmiCore::MappedRegion>), (override));
+        MOCK_METHOD(std::size_t, getMaximumMatchLength, (), (const, override));
     };
 }
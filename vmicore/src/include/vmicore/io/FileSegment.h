@@ -0,0 +1,22 @@
+#ifndef VMICORE_FILESEGMENT_H
+#define VMICORE_FILESEGMENT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace VmiCore
+{
+    /**
+     * A chunk of data that is written to a given position inside a file. The data is referenced, not copied, so it
+     * has to stay valid until the write call it is passed to returns.
+     */
+    struct FileSegment
+    {
+        /// Position of the first byte of the segment inside the file.
+        std::size_t offset;
+        std::span<const uint8_t> data;
+    };
+}
+
+#endif // VMICORE_FILESEGMENT_H
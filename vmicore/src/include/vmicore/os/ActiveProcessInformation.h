@@ -2,6 +2,7 @@
 #define VMICORE_ACTIVEPROCESSINFORMATION_H
 
 #include "IMemoryRegionExtractor.h"
+#include "LazyValue.h"
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -26,11 +27,13 @@ namespace VmiCore
         /// The name of the process. Possibly truncated to a fixed amount of characters which is usually a restriction
         /// of the process struct memory layout.
         std::string name;
-        /// The full name of the process without any length restrictions. Extracted from a location other than the
-        /// process struct.
-        std::unique_ptr<std::string> fullName;
-        /// The file path of the executable this process has been started from, if any.
-        std::unique_ptr<std::string> processPath;
+        /// The full name of the process without any length restrictions. Derived from processPath upon first access.
+        /// Empty if the name cannot be determined.
+        LazyValue<std::string> fullName;
+        /// The file path of the executable this process has been started from, if any. The executable is located when
+        /// the process is registered, as the kernel objects it is read from may be gone once the process exits.
+        /// Resolving the path itself may be deferred to a worker, in which case the first access waits for it.
+        LazyValue<std::string> processPath;
         /// An object that provides on-demand extraction of memory region descriptors. Parses kernel structures used for
         /// tracking memory allocations of processes.
         std::unique_ptr<IMemoryRegionExtractor> memoryRegionExtractor;
@@ -0,0 +1,76 @@
+#ifndef VMICORE_LAZYVALUE_H
+#define VMICORE_LAZYVALUE_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace VmiCore
+{
+    /**
+     * A value that is computed by a supplied extractor function on first access and memoized afterwards. Concurrent
+     * first accesses are synchronized, so the extractor runs at most once unless it throws. In the latter case the
+     * exception is propagated to the caller and the extraction will be retried on the next access.
+     *
+     * @tparam T Type of the held value. Has to be default constructible.
+     */
+    template <typename T> class LazyValue
+    {
+      public:
+        /// Creates an already resolved, default constructed value.
+        LazyValue() : state(std::make_unique<State>())
+        {
+            state->value.emplace();
+        }
+
+        /// Creates an already resolved value. Useful if the value is cheap to obtain or known upfront.
+        LazyValue(T value) : state(std::make_unique<State>()) // NOLINT(google-explicit-constructor)
+        {
+            state->value.emplace(std::move(value));
+        }
+
+        /// Creates a value that will be obtained by calling the given extractor on first access.
+        explicit LazyValue(std::function<T()> extractor) : state(std::make_unique<State>())
+        {
+            state->extractor = std::move(extractor);
+        }
+
+        [[nodiscard]] const T& get() const
+        {
+            std::call_once(state->once,
+                           [&state = *state]()
+                           {
+                               if (!state.value)
+                               {
+                                   state.value.emplace(state.extractor());
+                                   state.extractor = nullptr;
+                               }
+                           });
+            return *state->value;
+        }
+
+        const T& operator*() const
+        {
+            return get();
+        }
+
+        const T* operator->() const
+        {
+            return &get();
+        }
+
+      private:
+        struct State
+        {
+            std::once_flag once;
+            std::function<T()> extractor;
+            std::optional<T> value;
+        };
+
+        std::unique_ptr<State> state;
+    };
+}
+
+#endif // VMICORE_LAZYVALUE_H
@@ -0,0 +1,22 @@
+#ifndef VMICORE_THREADINFORMATION_H
+#define VMICORE_THREADINFORMATION_H
+
+#include <cstdint>
+#include <sys/types.h>
+
+namespace VmiCore
+{
+    /// OS-agnostic representation of a thread that shares the information of its process. Only reported for operating
+    /// systems which track threads as separate kernel tasks, which is currently Linux.
+    struct ThreadInformation
+    {
+        /// The base address of the thread struct in the kernel.
+        uint64_t base;
+        /// The thread ID, which is the pid of the task on Linux.
+        pid_t threadId;
+        /// The ID of the process the thread belongs to, which is the tgid of the task on Linux.
+        pid_t pid;
+    };
+}
+
+#endif // VMICORE_THREADINFORMATION_H
@@ -1,29 +1,46 @@
 #ifndef VMICORE_PLUGININTERFACE_H
 #define VMICORE_PLUGININTERFACE_H
 
+#include "../io/FileSegment.h"
 #include "../io/ILogger.h"
 #include "../os/ActiveProcessInformation.h"
+#include "../os/ThreadInformation.h"
 #include "../types.h"
 #include "../vmi/BpResponse.h"
 #include "../vmi/IBreakpoint.h"
 #include "../vmi/IIntrospectionAPI.h"
 #include "../vmi/IMemoryMapping.h"
+#include "../vmi/IMemorySnapshot.h"
 #include "../vmi/events/IInterruptEvent.h"
 #include <functional>
 #include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
 
 namespace VmiCore::Plugin
 {
+    /**
+     * Determines how process events are delivered to a subscribed plugin.
+     */
+    enum class EventDelivery
+    {
+        /// The callback is invoked while the guest vcpu that triggered the event is paused.
+        Synchronous,
+        /// The callback is invoked on a worker thread dedicated to the plugin. Events are delivered in the order of
+        /// their occurrence, but the guest continues to run in the meantime, so the memory of the process may already
+        /// have changed or vanished.
+        Asynchronous
+    };
+
     /**
      * Contains all functionality that is exposed to plugins.
      */
     class PluginInterface
     {
       public:
-        constexpr static uint8_t API_VERSION = 16;
+        constexpr static uint8_t API_VERSION = 24;
 
         virtual ~PluginInterface() = default;
 
@@ -39,11 +56,31 @@ namespace VmiCore::Plugin
         [[nodiscard]] virtual std::unique_ptr<IMemoryMapping>
         mapProcessMemoryRegion(addr_t baseVA, addr_t dtb, std::size_t numberOfPages) const = 0;
 
+        /**
+         * Copy the memory regions of a process into memory owned by the introspection application. In contrast to
+         * mapProcessMemoryRegion, the result stays valid after the guest has been resumed, which allows processing the
+         * memory of a terminating process asynchronously. Snapshot memory is taken from a pool whose size is limited
+         * by the plugin_system snapshot_memory_limit configuration option. This call never waits for other snapshots
+         * to be destroyed, as it is usually made while the guest is paused.
+         *
+         * @param processInformation The process to copy memory from. Can be obtained via getRunningProcesses() or
+         * from a process event.
+         * @param filter Selects the memory regions to copy. Regions for which the filter returns false are skipped.
+         * @return An instance of IMemorySnapshot. See IMemorySnapshot.h for details.
+         * @throws std::length_error If the selected regions are larger than the snapshot memory limit, or if the
+         * memory limit is currently taken up by other snapshots. Nothing has been copied in this case, so callers may
+         * fall back to processing the memory in place.
+         */
+        [[nodiscard]] virtual std::unique_ptr<IMemorySnapshot>
+        snapshotProcessMemory(const ActiveProcessInformation& processInformation,
+                              const std::function<bool(const MemoryRegion&)>& filter) const = 0;
+
         /**
          * Obtain a vector containing an OS-agnostic representation of all currently running processes.
-         * The vector is a snapshot of the current state, it won't receive any updates.
+         * The vector is an immutable snapshot of the current state, it won't receive any updates. Snapshots are shared
+         * between callers, so obtaining one is cheap and does not require any guest memory reads.
          */
-        [[nodiscard]] virtual std::unique_ptr<std::vector<std::shared_ptr<const ActiveProcessInformation>>>
+        [[nodiscard]] virtual std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>>
         getRunningProcesses() const = 0;
 
         /**
@@ -55,6 +92,20 @@ namespace VmiCore::Plugin
         virtual void registerProcessStartEvent(
             const std::function<void(std::shared_ptr<const ActiveProcessInformation>)>& startCallback) = 0;
 
+        /**
+         * Subscribe to process start events with the given delivery mode. Plugins that do not need the guest to be
+         * paused, e.g. because they only record information, should prefer asynchronous delivery in order to keep
+         * guest pauses short. Asynchronous delivery can only be requested from within vmicore_plugin_init, as the
+         * worker is assigned to the plugin being initialized. Events that occur after the plugins have been unloaded
+         * are dropped.
+         *
+         * @param startCallback See registerProcessStartEvent above.
+         * @param delivery See EventDelivery.
+         */
+        virtual void registerProcessStartEvent(
+            const std::function<void(std::shared_ptr<const ActiveProcessInformation>)>& startCallback,
+            EventDelivery delivery) = 0;
+
         /**
          * Subscribe to process termination events. The supplied lambda function will be called once the event occurs.
          *
@@ -64,6 +115,38 @@ namespace VmiCore::Plugin
         virtual void registerProcessTerminationEvent(
             const std::function<void(std::shared_ptr<const ActiveProcessInformation>)>& terminationCallback) = 0;
 
+        /**
+         * Subscribe to process termination events with the given delivery mode. Asynchronously delivered events
+         * share the worker of the plugin's asynchronous start events, so they are never delivered ahead of the start
+         * event of the same process. The restrictions of registerProcessStartEvent above apply as well.
+         *
+         * @param terminationCallback See registerProcessTerminationEvent above.
+         * @param delivery See EventDelivery.
+         */
+        virtual void registerProcessTerminationEvent(
+            const std::function<void(std::shared_ptr<const ActiveProcessInformation>)>& terminationCallback,
+            EventDelivery delivery) = 0;
+
+        /**
+         * Subscribe to thread start events. New threads share the information of their process, so they neither cause
+         * a process start event nor any extraction of their own. Only reported on Linux. Callbacks are invoked while
+         * the guest is paused and should therefore return quickly.
+         *
+         * @param startCallback Called with the new thread and the pid of the process it belongs to.
+         */
+        virtual void registerThreadStartEvent(const std::function<void(const ThreadInformation&)>& startCallback) = 0;
+
+        /**
+         * Subscribe to thread termination events. A process is terminated together with its last thread, which does
+         * not need to be the thread the process has been started with. Only this last exit causes a process
+         * termination event, all other exits are thread termination events. The restrictions of
+         * registerThreadStartEvent above apply as well.
+         *
+         * @param terminationCallback Called with the exiting thread and the pid of the process it belongs to.
+         */
+        virtual void
+        registerThreadTerminationEvent(const std::function<void(const ThreadInformation&)>& terminationCallback) = 0;
+
         /**
          * Create a software breakpoint at the given virtual address. The breakpoint will be protected, so that
          * it won't be visible to the guest through reading the memory. Multiple breakpoints per address are allowed and
@@ -105,6 +188,22 @@ namespace VmiCore::Plugin
          */
         virtual void writeToFile(const std::string& filename, const std::vector<uint8_t>& data) const = 0;
 
+        /**
+         * Appends data to a file with the given name, the file is created by the first call. Allows writing large
+         * files in chunks while they are being produced, without storing them in the results directory directly.
+         * Chunks appended concurrently to the same file may end up in any order.
+         */
+        virtual void appendToFile(const std::string& filename, std::span<const uint8_t> data) const = 0;
+
+        /**
+         * Saves a file of the given size that is made up of the given segments. Bytes not covered by any segment read
+         * as zero. In contrast to writeToFile, the segment data is written without being copied, so large files can be
+         * assembled directly from mapped guest memory. Saving the same file more than once is undefined behavior.
+         */
+        virtual void writeSegmentsToFile(const std::string& filename,
+                                         std::span<const FileSegment> segments,
+                                         std::size_t fileSize) const = 0;
+
         /**
          * Only useful if using a gRPC connection, does nothing otherwise. Will send an error event via a separate
          * channel which indicates that the run is not successful.
@@ -0,0 +1,26 @@
+#ifndef VMICORE_FRAMERUN_H
+#define VMICORE_FRAMERUN_H
+
+#include "../types.h"
+#include <compare>
+#include <cstddef>
+
+namespace VmiCore
+{
+    /**
+     * A range of virtual pages that is backed by a range of consecutive guest physical frames.
+     */
+    struct FrameRun
+    {
+        /// Virtual address of the first page inside the guest.
+        addr_t guestBaseVA;
+        /// Guest frame number backing the first page.
+        addr_t firstGfn;
+        /// Number of 4kb pages in this run.
+        std::size_t num_pages;
+
+        auto operator<=>(const FrameRun&) const = default;
+    };
+}
+
+#endif // VMICORE_FRAMERUN_H
@@ -3,6 +3,7 @@
 
 #include "../os/OperatingSystem.h"
 #include "../types.h"
+#include "FrameRun.h"
 #include <cstdint>
 #include <memory>
 #include <optional>
@@ -47,6 +48,14 @@ namespace VmiCore
 
         [[nodiscard]] virtual addr_t convertVAToPA(addr_t virtualAddress, addr_t cr3Register) = 0;
 
+        /**
+         * Translates all pages of a virtual address range to the guest frames backing them. Pages that are not present
+         * are omitted. Consecutive pages backed by consecutive frames are merged into a single run. In contrast to
+         * calling convertVAToPA for every page, the API-wide lock is only acquired once.
+         */
+        [[nodiscard]] virtual std::vector<FrameRun>
+        getFrameRuns(addr_t baseVA, addr_t dtb, std::size_t numberOfPages) = 0;
+
         [[nodiscard]] virtual addr_t convertPidToDtb(pid_t processID) = 0;
 
         [[nodiscard]] virtual pid_t convertDtbToPid(addr_t dtb) = 0;
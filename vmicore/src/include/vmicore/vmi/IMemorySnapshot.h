@@ -0,0 +1,48 @@
+#ifndef VMICORE_IMEMORYSNAPSHOT_H
+#define VMICORE_IMEMORYSNAPSHOT_H
+
+#include "../os/MemoryRegion.h"
+#include "MappedRegion.h"
+#include <span>
+
+namespace VmiCore
+{
+    /**
+     * A memory region of a process together with a copy of its content.
+     */
+    struct SnapshotRegion
+    {
+        /// Descriptor of the copied memory region.
+        MemoryRegion memoryRegionDescriptor;
+        /// Copies of the chunks of the region that were mapped at the time of the snapshot. The mapping bases point
+        /// into memory owned by the snapshot. Elements are ordered from lowest to highest guest VA.
+        std::span<const MappedRegion> mappedRegions;
+    };
+
+    /**
+     * Copy of selected memory regions of a process. The copy stays valid for the lifetime of this object regardless of
+     * the state of the guest, so it can be processed while the guest continues to run. The underlying memory is
+     * returned to a shared pool on destruction, therefore snapshots should not be kept longer than necessary.
+     */
+    class IMemorySnapshot
+    {
+      public:
+        virtual ~IMemorySnapshot() = default;
+
+        /**
+         * Retrieves all regions contained in the snapshot, ordered as they were provided by the memory region
+         * extractor of the process.
+         */
+        [[nodiscard]] virtual std::span<const SnapshotRegion> getRegions() const = 0;
+
+        /**
+         * Total number of bytes copied.
+         */
+        [[nodiscard]] virtual std::size_t size() const = 0;
+
+      protected:
+        IMemorySnapshot() = default;
+    };
+}
+
+#endif // VMICORE_IMEMORYSNAPSHOT_H
@@ -4,6 +4,12 @@
 
 namespace VmiCore
 {
+    namespace
+    {
+        constexpr std::size_t bytesPerMiB = 1024 * 1024;
+        constexpr std::size_t defaultSnapshotMemoryLimitMiB = 1024;
+    }
+
     void ConfigYAMLParser::extractConfiguration(const std::filesystem::path& configurationPath)
     {
         configRootNode = YAML::LoadFile(configurationPath);
@@ -16,6 +22,9 @@ namespace VmiCore
         }
         configuration.offsetsFile = configRootNode["vm"]["offsets_file"].as<std::string>();
         configuration.pluginDirectory = configRootNode["plugin_system"]["directory"].as<std::string>();
+        configuration.snapshotMemoryLimit =
+            configRootNode["plugin_system"]["snapshot_memory_limit"].as<std::size_t>(defaultSnapshotMemoryLimitMiB) *
+            bytesPerMiB;
 
         for (const auto& node : configRootNode["plugin_system"]["plugins"])
         {
@@ -75,6 +84,11 @@ namespace VmiCore
         return configuration.pluginDirectory;
     }
 
+    std::size_t ConfigYAMLParser::getSnapshotMemoryLimit() const
+    {
+        return configuration.snapshotMemoryLimit;
+    }
+
     const std::map<const std::string, const std::shared_ptr<Plugin::IPluginConfig>>&
     ConfigYAMLParser::getPlugins() const
     {
@@ -36,6 +36,8 @@ namespace VmiCore
 
         [[nodiscard]] virtual std::filesystem::path getPluginDirectory() const = 0;
 
+        [[nodiscard]] virtual std::size_t getSnapshotMemoryLimit() const = 0;
+
         [[nodiscard]] virtual const std::map<const std::string, const std::shared_ptr<Plugin::IPluginConfig>>&
         getPlugins() const = 0;
 
@@ -2,8 +2,10 @@
 #define VMICORE_IFILETRANSPORT_H
 
 #include <cstdint>
+#include <span>
 #include <string_view>
 #include <vector>
+#include <vmicore/io/FileSegment.h>
 
 namespace VmiCore
 {
@@ -14,6 +16,19 @@ namespace VmiCore
 
         virtual void saveBinaryToFile(std::string_view logFileName, const std::vector<uint8_t>& data) = 0;
 
+        /**
+         * Appends data to a file, the file is created if it does not exist yet. Allows writing a file in chunks while
+         * it is being produced.
+         */
+        virtual void appendToFile(std::string_view fileName, std::span<const uint8_t> data) = 0;
+
+        /**
+         * Creates a file of the given size which contains the given segments. Bytes not covered by any segment read as
+         * zero.
+         */
+        virtual void
+        saveSegmentsToFile(std::string_view fileName, std::span<const FileSegment> segments, std::size_t fileSize) = 0;
+
       protected:
         IFileTransport() = default;
     };
@@ -1,10 +1,36 @@
 #include "LegacyLogging.h"
+#include <cerrno>
 #include <cstdint>
 #include <exception>
-#include <filesystem>
+#include <fcntl.h>
+#include <system_error>
+#include <unistd.h>
 
 namespace VmiCore
 {
+    namespace
+    {
+        void writeSegment(int fileDescriptor, const FileSegment& segment)
+        {
+            auto remaining = segment.data;
+            auto offset = static_cast<off_t>(segment.offset);
+            while (!remaining.empty())
+            {
+                auto written = pwrite(fileDescriptor, remaining.data(), remaining.size(), offset);
+                if (written < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+                    throw std::system_error(errno, std::generic_category(), "Unable to write file segment");
+                }
+                remaining = remaining.subspan(static_cast<std::size_t>(written));
+                offset += written;
+            }
+        }
+    }
+
     LegacyLogging::LegacyLogging(std::shared_ptr<IConfigParser> configInterface)
         : configInterface(std::move(configInterface))
     {
@@ -12,19 +38,19 @@ namespace VmiCore
 
     void LegacyLogging::saveBinaryToFile(std::string_view logFileName, const std::vector<uint8_t>& data)
     {
-        auto path = configInterface->getResultsDirectory() / logFileName;
-        auto parentPath = path.parent_path();
-        if (!parentPath.empty())
-        {
-            std::filesystem::create_directories(parentPath);
-        }
+        appendToFile(logFileName, data);
+    }
+
+    void LegacyLogging::appendToFile(std::string_view fileName, std::span<const uint8_t> data)
+    {
+        auto path = createResultFilePath(fileName);
 
         std::ofstream ofStream;
         ofStream.exceptions(std::ios::failbit | std::ios::badbit);
         ofStream.open(path, std::ios::app | std::ios::binary);
         try
         {
-            ofStream.write(reinterpret_cast<const char*>(data.data()), data.size());
+            ofStream.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
         }
         catch (const std::exception& e)
         {
@@ -33,4 +59,51 @@ namespace VmiCore
         }
         ofStream.close();
     }
+
+    void LegacyLogging::saveSegmentsToFile(std::string_view fileName,
+                                           std::span<const FileSegment> segments,
+                                           std::size_t fileSize)
+    {
+        auto path = createResultFilePath(fileName);
+
+        auto fileDescriptor = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fileDescriptor < 0)
+        {
+            throw std::system_error(errno, std::generic_category(), "Unable to open " + path.string());
+        }
+        try
+        {
+            // Extending the empty file leaves a hole, so gaps between segments do not occupy any disk space
+            if (ftruncate(fileDescriptor, static_cast<off_t>(fileSize)) != 0)
+            {
+                throw std::system_error(errno, std::generic_category(), "Unable to resize " + path.string());
+            }
+            // Segments are written straight from the caller's memory without an intermediate buffer
+            for (const auto& segment : segments)
+            {
+                writeSegment(fileDescriptor, segment);
+            }
+        }
+        catch (...)
+        {
+            close(fileDescriptor);
+            throw;
+        }
+        if (close(fileDescriptor) != 0)
+        {
+            throw std::system_error(errno, std::generic_category(), "Unable to close " + path.string());
+        }
+    }
+
+    std::filesystem::path LegacyLogging::createResultFilePath(std::string_view fileName) const
+    {
+        auto path = configInterface->getResultsDirectory() / fileName;
+        auto parentPath = path.parent_path();
+        if (!parentPath.empty())
+        {
+            std::filesystem::create_directories(parentPath);
+        }
+
+        return path;
+    }
 }
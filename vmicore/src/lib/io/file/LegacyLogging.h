@@ -3,6 +3,7 @@
 
 #include "../../config/IConfigParser.h"
 #include "../IFileTransport.h"
+#include <filesystem>
 #include <fstream>
 #include <map>
 #include <memory>
@@ -17,8 +18,16 @@ namespace VmiCore
 
         void saveBinaryToFile(std::string_view logFileName, const std::vector<uint8_t>& data) override;
 
+        void appendToFile(std::string_view fileName, std::span<const uint8_t> data) override;
+
+        void saveSegmentsToFile(std::string_view fileName,
+                                std::span<const FileSegment> segments,
+                                std::size_t fileSize) override;
+
       private:
         std::shared_ptr<IConfigParser> configInterface;
+
+        [[nodiscard]] std::filesystem::path createResultFilePath(std::string_view fileName) const;
     };
 }
 
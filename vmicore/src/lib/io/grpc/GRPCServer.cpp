@@ -1,6 +1,7 @@
 #include "GRPCServer.h"
 #include "../RustHelper.h"
 #include "GRPCLogger.h"
+#include <algorithm>
 #include <exception>
 #include <iostream>
 #include <memory>
@@ -47,6 +48,25 @@ namespace VmiCore
         (*server)->write_message_to_file(toRustStr(logFileName), data);
     }
 
+    void GRPCServer::appendToFile(std::string_view fileName, std::span<const uint8_t> data)
+    {
+        // Every message is delivered as a separate chunk of the file, so the receiver concatenates them
+        saveBinaryToFile(fileName, std::vector<uint8_t>(data.begin(), data.end()));
+    }
+
+    void GRPCServer::saveSegmentsToFile(std::string_view fileName,
+                                        std::span<const FileSegment> segments,
+                                        std::size_t fileSize)
+    {
+        // The gRPC channel only transfers whole messages, so the file content has to be assembled first
+        std::vector<uint8_t> data(fileSize, 0);
+        for (const auto& segment : segments)
+        {
+            std::ranges::copy(segment.data, std::next(data.begin(), static_cast<std::ptrdiff_t>(segment.offset)));
+        }
+        saveBinaryToFile(fileName, data);
+    }
+
     void GRPCServer::sendProcessEvent(::grpc::ProcessState processState,
                                       std::string_view processName,
                                       uint32_t processID,
@@ -29,6 +29,12 @@ namespace VmiCore
 
         void saveBinaryToFile(std::string_view logFileName, const std::vector<uint8_t>& data) override;
 
+        void appendToFile(std::string_view fileName, std::span<const uint8_t> data) override;
+
+        void saveSegmentsToFile(std::string_view fileName,
+                                std::span<const FileSegment> segments,
+                                std::size_t fileSize) override;
+
         void sendProcessEvent(::grpc::ProcessState processState,
                               std::string_view processName,
                               uint32_t processID,
@@ -3,8 +3,10 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <vector>
 #include <vmicore/os/ActiveProcessInformation.h>
+#include <vmicore/os/ThreadInformation.h>
 
 namespace VmiCore
 {
@@ -22,11 +24,17 @@ namespace VmiCore
         [[nodiscard]] virtual std::shared_ptr<ActiveProcessInformation>
         getProcessInformationByBase(uint64_t base) const = 0;
 
+        /**
+         * Returns the thread located at the given base, if the base belongs to an additional thread of a process
+         * rather than to the process itself.
+         */
+        [[nodiscard]] virtual std::optional<ThreadInformation> getThreadInformationByBase(uint64_t base) const = 0;
+
         virtual void addNewProcess(uint64_t base) = 0;
 
         virtual void removeActiveProcess(uint64_t base) = 0;
 
-        [[nodiscard]] virtual std::unique_ptr<std::vector<std::shared_ptr<const ActiveProcessInformation>>>
+        [[nodiscard]] virtual std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>>
         getActiveProcesses() const = 0;
 
       protected:
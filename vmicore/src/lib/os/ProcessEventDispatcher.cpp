@@ -0,0 +1,96 @@
+#include "ProcessEventDispatcher.h"
+#include <stdexcept>
+#include <vmicore/filename.h>
+
+namespace VmiCore
+{
+    ProcessEventDispatcher::ProcessEventDispatcher(const std::shared_ptr<ILogging>& logging, std::size_t capacity)
+        : logger(logging->newNamedLogger(FILENAME_STEM)),
+          capacity(capacity),
+          worker(&ProcessEventDispatcher::processTasks, this)
+    {
+    }
+
+    ProcessEventDispatcher::~ProcessEventDispatcher()
+    {
+        stop();
+    }
+
+    void ProcessEventDispatcher::post(std::function<void()> task)
+    {
+        if (!enqueue(std::move(task)))
+        {
+            throw std::runtime_error("Process event dispatcher has already been stopped");
+        }
+    }
+
+    bool ProcessEventDispatcher::tryPost(std::function<void()> task)
+    {
+        return enqueue(std::move(task));
+    }
+
+    void ProcessEventDispatcher::postAndWait(std::function<void()> task)
+    {
+        auto packagedTask = std::make_shared<std::packaged_task<void()>>(std::move(task));
+        auto result = packagedTask->get_future();
+        post([packagedTask]() { (*packagedTask)(); });
+        result.get();
+    }
+
+    void ProcessEventDispatcher::stop()
+    {
+        {
+            std::scoped_lock lock(queueLock);
+            stopping = true;
+        }
+        queueNotEmpty.notify_all();
+        queueNotFull.notify_all();
+        if (worker.joinable() && worker.get_id() != std::this_thread::get_id())
+        {
+            worker.join();
+        }
+    }
+
+    bool ProcessEventDispatcher::enqueue(std::function<void()> task)
+    {
+        {
+            std::unique_lock lock(queueLock);
+            queueNotFull.wait(lock, [this]() { return stopping || queue.size() < capacity; });
+            if (stopping)
+            {
+                return false;
+            }
+            queue.push_back(std::move(task));
+        }
+        queueNotEmpty.notify_one();
+        return true;
+    }
+
+    void ProcessEventDispatcher::processTasks()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(queueLock);
+                queueNotEmpty.wait(lock, [this]() { return stopping || !queue.empty(); });
+                if (queue.empty())
+                {
+                    return;
+                }
+                task = std::move(queue.front());
+                queue.pop_front();
+            }
+            queueNotFull.notify_one();
+
+            try
+            {
+                task();
+            }
+            catch (const std::exception& e)
+            {
+                logger->error("Unable to process process event", {{"Exception", e.what()}});
+            }
+        }
+    }
+}
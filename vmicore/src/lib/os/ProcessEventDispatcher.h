@@ -0,0 +1,72 @@
+#ifndef VMICORE_PROCESSEVENTDISPATCHER_H
+#define VMICORE_PROCESSEVENTDISPATCHER_H
+
+#include "../io/ILogging.h"
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vmicore/io/ILogger.h>
+
+namespace VmiCore
+{
+    /**
+     * Processes work resulting from process lifecycle events on a single worker thread in the order of submission.
+     * This allows breakpoint callbacks to only capture the necessary state while the guest is paused and defer
+     * everything else. The queue is bounded, so submitting blocks the caller once the worker falls too far behind.
+     */
+    class ProcessEventDispatcher
+    {
+      public:
+        ProcessEventDispatcher(const std::shared_ptr<ILogging>& logging, std::size_t capacity);
+
+        ~ProcessEventDispatcher();
+
+        ProcessEventDispatcher(const ProcessEventDispatcher&) = delete;
+
+        ProcessEventDispatcher& operator=(const ProcessEventDispatcher&) = delete;
+
+        /**
+         * Enqueues a task without waiting for its completion. Exceptions thrown by the task are logged.
+         */
+        void post(std::function<void()> task);
+
+        /**
+         * Like post, but silently drops the task if the dispatcher has already been stopped.
+         *
+         * @return Whether the task has been enqueued.
+         */
+        bool tryPost(std::function<void()> task);
+
+        /**
+         * Enqueues a task and waits until it and all previously submitted tasks have been processed. Exceptions thrown
+         * by the task are rethrown to the caller.
+         */
+        void postAndWait(std::function<void()> task);
+
+        /**
+         * Processes all remaining tasks and stops the worker. Further submissions are rejected.
+         */
+        void stop();
+
+      private:
+        std::unique_ptr<ILogger> logger;
+        std::size_t capacity;
+        std::mutex queueLock;
+        std::condition_variable queueNotEmpty;
+        std::condition_variable queueNotFull;
+        std::deque<std::function<void()>> queue;
+        bool stopping = false;
+        std::thread worker;
+
+        bool enqueue(std::function<void()> task);
+
+        void processTasks();
+    };
+}
+
+#endif // VMICORE_PROCESSEVENTDISPATCHER_H
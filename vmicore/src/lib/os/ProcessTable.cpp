@@ -0,0 +1,117 @@
+#include "ProcessTable.h"
+#include <algorithm>
+#include <iterator>
+
+namespace VmiCore
+{
+    ProcessTable::ProcessTable()
+        : activeProcesses(std::make_shared<const std::vector<std::shared_ptr<const ActiveProcessInformation>>>())
+    {
+    }
+
+    std::shared_ptr<ActiveProcessInformation> ProcessTable::findByPid(pid_t pid) const
+    {
+        auto processInformationIterator = processInformationByPid.find(pid);
+        if (processInformationIterator == processInformationByPid.cend())
+        {
+            return nullptr;
+        }
+        return processInformationIterator->second;
+    }
+
+    std::optional<pid_t> ProcessTable::findPidByBase(uint64_t base) const
+    {
+        auto pidIterator = pidsByBase.find(base);
+        if (pidIterator == pidsByBase.cend())
+        {
+            return std::nullopt;
+        }
+        return pidIterator->second;
+    }
+
+    std::optional<pid_t> ProcessTable::findThreadIdByBase(uint64_t base) const
+    {
+        auto threadIdIterator = threadIdsByBase.find(base);
+        if (threadIdIterator == threadIdsByBase.cend())
+        {
+            return std::nullopt;
+        }
+        return threadIdIterator->second;
+    }
+
+    const std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>>&
+    ProcessTable::getActiveProcesses() const
+    {
+        return activeProcesses;
+    }
+
+    std::shared_ptr<const ProcessTable>
+    ProcessTable::withProcess(const std::shared_ptr<ActiveProcessInformation>& processInformation, bool isActive) const
+    {
+        auto updatedTable = std::make_shared<ProcessTable>(*this);
+        updatedTable->removeBasesOf(processInformation->pid);
+        updatedTable->processInformationByPid[processInformation->pid] = processInformation;
+        updatedTable->pidsByBase[processInformation->base] = processInformation->pid;
+        updatedTable->threadIdsByBase.erase(processInformation->base);
+
+        auto updatedActiveProcesses = std::make_shared<std::vector<std::shared_ptr<const ActiveProcessInformation>>>();
+        updatedActiveProcesses->reserve(activeProcesses->size() + 1);
+        std::copy_if(activeProcesses->cbegin(),
+                     activeProcesses->cend(),
+                     std::back_inserter(*updatedActiveProcesses),
+                     [&processInformation](const std::shared_ptr<const ActiveProcessInformation>& element)
+                     { return element->pid != processInformation->pid && element->base != processInformation->base; });
+        if (isActive)
+        {
+            updatedActiveProcesses->push_back(processInformation);
+        }
+        updatedTable->activeProcesses = std::move(updatedActiveProcesses);
+
+        return updatedTable;
+    }
+
+    std::shared_ptr<const ProcessTable> ProcessTable::withThread(uint64_t base, pid_t pid, pid_t threadId) const
+    {
+        auto updatedTable = std::make_shared<ProcessTable>(*this);
+        updatedTable->pidsByBase[base] = pid;
+        updatedTable->threadIdsByBase[base] = threadId;
+        return updatedTable;
+    }
+
+    std::shared_ptr<const ProcessTable> ProcessTable::withoutProcess(uint64_t base) const
+    {
+        auto updatedTable = std::make_shared<ProcessTable>(*this);
+        auto pidIterator = updatedTable->pidsByBase.find(base);
+        if (pidIterator == updatedTable->pidsByBase.end())
+        {
+            return updatedTable;
+        }
+
+        const auto pid = pidIterator->second;
+        updatedTable->pidsByBase.erase(pidIterator);
+        updatedTable->threadIdsByBase.erase(base);
+        if (std::ranges::any_of(updatedTable->pidsByBase, [pid](const auto& element) { return element.second == pid; }))
+        {
+            return updatedTable;
+        }
+
+        updatedTable->processInformationByPid.erase(pid);
+        auto updatedActiveProcesses = std::make_shared<std::vector<std::shared_ptr<const ActiveProcessInformation>>>();
+        updatedActiveProcesses->reserve(activeProcesses->size());
+        std::copy_if(activeProcesses->cbegin(),
+                     activeProcesses->cend(),
+                     std::back_inserter(*updatedActiveProcesses),
+                     [pid](const std::shared_ptr<const ActiveProcessInformation>& element)
+                     { return element->pid != pid; });
+        updatedTable->activeProcesses = std::move(updatedActiveProcesses);
+
+        return updatedTable;
+    }
+
+    void ProcessTable::removeBasesOf(pid_t pid)
+    {
+        std::erase_if(threadIdsByBase,
+                      [this, pid](const auto& element) { return pidsByBase.at(element.first) == pid; });
+        std::erase_if(pidsByBase, [pid](const auto& element) { return element.second == pid; });
+    }
+}
@@ -0,0 +1,66 @@
+#ifndef VMICORE_PROCESSTABLE_H
+#define VMICORE_PROCESSTABLE_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <vmicore/os/ActiveProcessInformation.h>
+
+namespace VmiCore
+{
+    /**
+     * Immutable view of all processes known to an active processes supervisor. Modifications return a new table and
+     * leave the original one untouched, which allows readers to hold on to a table without any synchronization while
+     * the supervisor publishes an updated version.
+     */
+    class ProcessTable
+    {
+      public:
+        ProcessTable();
+
+        [[nodiscard]] std::shared_ptr<ActiveProcessInformation> findByPid(pid_t pid) const;
+
+        [[nodiscard]] std::optional<pid_t> findPidByBase(uint64_t base) const;
+
+        /**
+         * Returns the thread id of the thread located at the given base. Only bases added via withThread are threads.
+         */
+        [[nodiscard]] std::optional<pid_t> findThreadIdByBase(uint64_t base) const;
+
+        [[nodiscard]] const std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>>&
+        getActiveProcesses() const;
+
+        /**
+         * Creates a copy of this table which additionally contains the given process. Entries with the same pid or
+         * base are replaced, including the threads of a replaced process. Inactive processes can still be looked up
+         * but are not part of the active processes.
+         */
+        [[nodiscard]] std::shared_ptr<const ProcessTable>
+        withProcess(const std::shared_ptr<ActiveProcessInformation>& processInformation, bool isActive) const;
+
+        /**
+         * Creates a copy of this table in which the given base additionally resolves to the already present process
+         * with the given pid. Used for threads that share the information of their process.
+         */
+        [[nodiscard]] std::shared_ptr<const ProcessTable> withThread(uint64_t base, pid_t pid, pid_t threadId) const;
+
+        /**
+         * Creates a copy of this table in which the given base no longer resolves to its process. The process itself
+         * is only removed together with the last base resolving to it, so it outlives a thread it has been started
+         * with as long as any of its other threads is still present.
+         */
+        [[nodiscard]] std::shared_ptr<const ProcessTable> withoutProcess(uint64_t base) const;
+
+      private:
+        std::map<pid_t, std::shared_ptr<ActiveProcessInformation>> processInformationByPid;
+        std::map<uint64_t, pid_t> pidsByBase;
+        std::map<uint64_t, pid_t> threadIdsByBase;
+        std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>> activeProcesses;
+
+        void removeBasesOf(pid_t pid);
+    };
+}
+
+#endif // VMICORE_PROCESSTABLE_H
@@ -1,6 +1,7 @@
 #include "ActiveProcessesSupervisor.h"
 #include "Constants.h"
 #include "MMExtractor.h"
+#include <algorithm>
 #include <fmt/core.h>
 #include <string>
 #include <vmicore/filename.h>
@@ -16,26 +17,25 @@ namespace VmiCore::Linux
           logging(loggingLib),
           logger(loggingLib->newNamedLogger(FILENAME_STEM)),
           eventStream(std::move(eventStream)),
-          pathExtractor(std::move(vmiInterface), loggingLib)
+          kernelOffsets(std::make_shared<const KernelOffsets>(KernelOffsets::init(this->vmiInterface))),
+          pathExtractor(std::move(vmiInterface), kernelOffsets, pathCache, loggingLib),
+          processEventDispatcher(std::make_unique<ProcessEventDispatcher>(loggingLib, PROCESS_EVENT_QUEUE_CAPACITY))
     {
     }
 
     void ActiveProcessesSupervisor::initialize()
     {
-        // Check if kernel is recent enough to have PTI support (backports for LTS releases are currently ignored)
-        if (auto [major, minor, _patch] = extractKernelVersion(); major > 4 || (major == 4 && minor >= 15))
-        {
-            // Check if kernel page table isolation is enabled
-            auto x86CapabilityOffset = vmiInterface->getKernelStructOffset("cpuinfo_x86", "x86_capability");
-            // X86_FEATURE_PTI is defined as 7*32+11
-            auto x86CapabilityEntry = vmiInterface->read32VA(vmiInterface->translateKernelSymbolToVA("boot_cpu_data") +
-                                                                 x86CapabilityOffset + PTI_FEATURE_ARRAY_ENTRY_OFFSET,
-                                                             vmiInterface->convertPidToDtb(SYSTEM_PID));
-            pti = x86CapabilityEntry & PTI_FEATURE_MASK;
-        }
+        kernelProfile = std::make_shared<const KernelProfile>(KernelProfile::init(vmiInterface, *kernelOffsets));
+        logger->info("Kernel profile selected",
+                     {{"KernelVersion",
+                       fmt::format("{}.{}.{}",
+                                   kernelProfile->version.major,
+                                   kernelProfile->version.minor,
+                                   kernelProfile->version.patch)},
+                      {"PTI", kernelProfile->pti}});
 
         logger->info("--- Initialization ---");
-        auto taskOffset = vmiInterface->getOffset("linux_tasks");
+        auto taskOffset = kernelOffsets->libvmi.tasks;
         auto initTaskVA = vmiInterface->translateKernelSymbolToVA("init_task") + taskOffset;
         auto currentListEntry = initTaskVA;
         logger->debug("Got VA of initTask", {{"initTaskVA", fmt::format("{:#x}", currentListEntry)}});
@@ -43,46 +43,85 @@ namespace VmiCore::Linux
         do
         {
             addNewProcess(currentListEntry - taskOffset);
+            if (kernelOffsets->threadGroup)
+            {
+                addThreadsOf(currentListEntry - taskOffset);
+            }
             currentListEntry = vmiInterface->read64VA(currentListEntry, vmiInterface->convertPidToDtb(SYSTEM_PID));
         } while (currentListEntry != initTaskVA);
 
         logger->info("--- End of Initialization ---");
     }
 
+    void ActiveProcessesSupervisor::addThreadsOf(uint64_t taskStruct)
+    {
+        // Only thread group leaders are part of the task list, their threads are linked in the shared signal_struct
+        try
+        {
+            const auto dtb = vmiInterface->convertPidToDtb(SYSTEM_PID);
+            const auto threadHead = vmiInterface->read64VA(taskStruct + kernelOffsets->threadGroup->signal, dtb) +
+                                    kernelOffsets->threadGroup->thread_head;
+            for (auto threadNode = vmiInterface->read64VA(threadHead, dtb); threadNode != threadHead;
+                 threadNode = vmiInterface->read64VA(threadNode, dtb))
+            {
+                if (const auto thread = threadNode - kernelOffsets->threadGroup->thread_node; thread != taskStruct)
+                {
+                    addNewProcess(thread);
+                }
+            }
+        }
+        catch (const std::exception& e)
+        {
+            logger->warning("Unable to extract threads of process",
+                            {{"taskStruct", fmt::format("{:#x}", taskStruct)}, {"Exception", e.what()}});
+        }
+    }
+
     std::unique_ptr<ActiveProcessInformation> ActiveProcessesSupervisor::extractProcessInformation(uint64_t taskStruct)
     {
         auto processInformation = std::make_unique<ActiveProcessInformation>();
         processInformation->base = taskStruct;
+        processInformation->pid = extractPid(taskStruct);
+        processInformation->parentPid = vmiInterface->read32VA(
+            vmiInterface->read64VA(taskStruct + kernelOffsets->taskStruct.real_parent,
+                                   vmiInterface->convertPidToDtb(SYSTEM_PID)) +
+                kernelOffsets->taskStruct.tgid,
+            vmiInterface->convertPidToDtb(SYSTEM_PID));
+        processInformation->name = *vmiInterface->extractStringAtVA(taskStruct + kernelOffsets->libvmi.name,
+                                                                    vmiInterface->convertPidToDtb(SYSTEM_PID));
 
-        auto mm = vmiInterface->read64VA(taskStruct + vmiInterface->getKernelStructOffset("task_struct", "mm"),
+        auto mm = vmiInterface->read64VA(taskStruct + kernelOffsets->taskStruct.mm,
                                          vmiInterface->convertPidToDtb(SYSTEM_PID));
         if (mm != 0)
         {
             processInformation->processDtb =
-                vmiInterface->convertVAToPA(vmiInterface->read64VA(mm + vmiInterface->getOffset("linux_pgd"),
+                vmiInterface->convertVAToPA(vmiInterface->read64VA(mm + kernelOffsets->libvmi.pgd,
                                                                    vmiInterface->convertPidToDtb(SYSTEM_PID)),
                                             vmiInterface->convertPidToDtb(SYSTEM_PID));
             processInformation->processUserDtb =
-                pti ? processInformation->processDtb + USER_DTB_OFFSET : processInformation->processDtb;
-            processInformation->processPath = std::make_unique<std::string>(pathExtractor.extractDPath(
-                vmiInterface->read64VA(mm + vmiInterface->getKernelStructOffset("mm_struct", "exe_file"),
-                                       vmiInterface->convertPidToDtb(SYSTEM_PID)) +
-                vmiInterface->getKernelStructOffset("file", "f_path")));
-            processInformation->fullName = processInformation->processPath
-                                               ? splitProcessFileNameFromPath(*processInformation->processPath)
-                                               : nullptr;
-            processInformation->memoryRegionExtractor = std::make_unique<MMExtractor>(vmiInterface, logging, mm);
+                kernelProfile->pti ? processInformation->processDtb + USER_DTB_OFFSET : processInformation->processDtb;
+            auto processPath = deferProcessPathExtraction(mm, processInformation->pid, processInformation->name);
+            processInformation->fullName = LazyValue<std::string>(
+                [processPath]()
+                {
+                    if (processPath.get().empty())
+                    {
+                        return std::string{};
+                    }
+                    try
+                    {
+                        return *splitProcessFileNameFromPath(processPath.get());
+                    }
+                    catch (const VmiException&)
+                    {
+                        return std::string{};
+                    }
+                });
+            processInformation->processPath = LazyValue<std::string>([processPath]() { return processPath.get(); });
+            processInformation->memoryRegionExtractor = std::make_unique<MMExtractor>(
+                vmiInterface, kernelOffsets, kernelProfile->vmAreaWalker, pathCache, logging, mm);
         }
 
-        processInformation->pid = extractPid(taskStruct);
-        processInformation->parentPid = vmiInterface->read32VA(
-            vmiInterface->read64VA(taskStruct + vmiInterface->getKernelStructOffset("task_struct", "real_parent"),
-                                   vmiInterface->convertPidToDtb(SYSTEM_PID)) +
-                vmiInterface->getKernelStructOffset("task_struct", "tgid"),
-            vmiInterface->convertPidToDtb(SYSTEM_PID));
-        processInformation->name = *vmiInterface->extractStringAtVA(taskStruct + vmiInterface->getOffset("linux_name"),
-                                                                    vmiInterface->convertPidToDtb(SYSTEM_PID));
-
         // Special case: The process with pid 0 only consists of idle threads and therefore has got no mm_struct. In
         // this case we simply use the kpgd that's already stored in libvmi.
         if (processInformation->pid == SYSTEM_PID)
@@ -96,23 +135,76 @@ namespace VmiCore::Linux
 
     pid_t ActiveProcessesSupervisor::extractPid(uint64_t taskStruct) const
     {
-        return static_cast<pid_t>(vmiInterface->read32VA(taskStruct + vmiInterface->getOffset("linux_pid"),
+        return static_cast<pid_t>(vmiInterface->read32VA(taskStruct + kernelOffsets->libvmi.pid,
                                                          vmiInterface->convertPidToDtb(SYSTEM_PID)));
     }
 
-    std::shared_ptr<ActiveProcessInformation> ActiveProcessesSupervisor::getSystemProcessInformation() const
+    pid_t ActiveProcessesSupervisor::extractTgid(uint64_t taskStruct) const
     {
-        return getProcessInformationByPid(SYSTEM_PID);
+        return static_cast<pid_t>(vmiInterface->read32VA(taskStruct + kernelOffsets->taskStruct.tgid,
+                                                         vmiInterface->convertPidToDtb(SYSTEM_PID)));
     }
 
-    std::shared_ptr<ActiveProcessInformation> ActiveProcessesSupervisor::getProcessInformationByPid(pid_t pid) const
+    std::shared_future<std::string>
+    ActiveProcessesSupervisor::deferProcessPathExtraction(uint64_t mm, pid_t pid, const std::string& name)
     {
-        std::shared_ptr<ActiveProcessInformation> processInformation;
+        auto pathExtraction = std::make_shared<std::promise<std::string>>();
+        std::shared_future<std::string> processPath = pathExtraction->get_future().share();
+
+        // Once the process exits, the kernel clears mm->exe_file and releases the file, so its dentry and mount have
+        // to be captured while the guest is paused in the event handler. Walking the dentries is left to the worker.
+        DPath executable{};
         try
         {
-            processInformation = processInformationByPid.at(pid);
+            if (auto exeFile = vmiInterface->read64VA(mm + kernelOffsets->mmStruct.exe_file,
+                                                      vmiInterface->convertPidToDtb(SYSTEM_PID)))
+            {
+                executable = pathExtractor.readDPath(exeFile + kernelOffsets->file.f_path);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            logger->warning(
+                "Unable to extract process path",
+                {{"ProcessName", name}, {"ProcessId", static_cast<uint64_t>(pid)}, {"Exception", e.what()}});
         }
-        catch (const std::out_of_range&)
+
+        auto extractPath = [this, pathExtraction, executable, pid, name]()
+        { pathExtraction->set_value(tryExtractProcessPath(executable, pid, name)); };
+        if (!processEventDispatcher->tryPost(extractPath))
+        {
+            extractPath();
+        }
+
+        return processPath;
+    }
+
+    std::string ActiveProcessesSupervisor::tryExtractProcessPath(const DPath& executable,
+                                                                 pid_t pid,
+                                                                 const std::string& name) const
+    {
+        try
+        {
+            return pathExtractor.extractDPath(executable);
+        }
+        catch (const std::exception& e)
+        {
+            logger->warning(
+                "Unable to extract process path",
+                {{"ProcessName", name}, {"ProcessId", static_cast<uint64_t>(pid)}, {"Exception", e.what()}});
+        }
+        return {};
+    }
+
+    std::shared_ptr<ActiveProcessInformation> ActiveProcessesSupervisor::getSystemProcessInformation() const
+    {
+        return getProcessInformationByPid(SYSTEM_PID);
+    }
+
+    std::shared_ptr<ActiveProcessInformation> ActiveProcessesSupervisor::getProcessInformationByPid(pid_t pid) const
+    {
+        auto processInformation = std::atomic_load(&processTable)->findByPid(pid);
+        if (!processInformation)
         {
             throw std::invalid_argument("Unable to find process with pid " + std::to_string(pid));
         }
@@ -122,107 +214,155 @@ namespace VmiCore::Linux
     std::shared_ptr<ActiveProcessInformation>
     ActiveProcessesSupervisor::getProcessInformationByBase(uint64_t taskStruct) const
     {
-        const auto pidIterator = pidsByTaskStruct.find(taskStruct);
-        if (pidIterator == pidsByTaskStruct.cend())
+        auto currentProcessTable = std::atomic_load(&processTable);
+        const auto pid = currentProcessTable->findPidByBase(taskStruct);
+        if (!pid)
         {
             throw std::invalid_argument(
                 fmt::format("{}: Process with taskStruct {:#x} not in process cache.", __func__, taskStruct));
         }
-        return getProcessInformationByPid(pidIterator->second);
+        auto processInformation = currentProcessTable->findByPid(*pid);
+        if (!processInformation)
+        {
+            throw std::invalid_argument("Unable to find process with pid " + std::to_string(*pid));
+        }
+        return processInformation;
     }
 
-    void ActiveProcessesSupervisor::addNewProcess(uint64_t taskStruct)
+    std::optional<ThreadInformation> ActiveProcessesSupervisor::getThreadInformationByBase(uint64_t taskStruct) const
     {
-        std::shared_ptr<ActiveProcessInformation> processInformation(extractProcessInformation(taskStruct));
-        std::string parentPid("unknownParentPid");
-        std::string parentName("unknownParentName");
-        std::string parentDtb("unknownParentDtb");
-        auto parentProcessInformation = processInformationByPid.find(processInformation->parentPid);
-        if (parentProcessInformation != processInformationByPid.end())
-        {
-            parentPid = std::to_string(parentProcessInformation->second->pid);
-            parentName = parentProcessInformation->second->name;
-            parentDtb = fmt::format("{:#x}", parentProcessInformation->second->processDtb);
-        }
-        eventStream->sendProcessEvent(::grpc::ProcessState::Started,
-                                      processInformation->name,
-                                      static_cast<uint32_t>(processInformation->pid),
-                                      fmt::format("{:#x}", processInformation->processDtb));
-        logger->info("Discovered active process",
-                     {{"ProcessName", processInformation->name},
-                      {"ProcessId", static_cast<uint64_t>(processInformation->pid)},
-                      {"ProcessDtb", fmt::format("{:#x}", processInformation->processDtb)},
-                      {"ProcessUserDtb", fmt::format("{:#x}", processInformation->processUserDtb)},
-                      {"ParentProcessName", parentName},
-                      {"ParentProcessId", parentPid},
-                      {"ParentProcessDtb", parentDtb}});
-        processInformationByPid[processInformation->pid] = processInformation;
-        pidsByTaskStruct[processInformation->base] = processInformation->pid;
+        auto currentProcessTable = std::atomic_load(&processTable);
+        const auto pid = currentProcessTable->findPidByBase(taskStruct);
+        const auto threadId = currentProcessTable->findThreadIdByBase(taskStruct);
+        if (!pid || !threadId)
+        {
+            return std::nullopt;
+        }
+        return ThreadInformation{.base = taskStruct, .threadId = *threadId, .pid = *pid};
     }
 
-    void ActiveProcessesSupervisor::removeActiveProcess(uint64_t taskStruct)
+    void ActiveProcessesSupervisor::addNewProcess(uint64_t taskStruct)
     {
-        auto taskStructIterator = pidsByTaskStruct.find(taskStruct);
-        if (taskStructIterator != pidsByTaskStruct.end())
+        // Threads share the mm and therefore all information with their thread group leader
+        if (const auto pid = extractPid(taskStruct), tgid = extractTgid(taskStruct); pid != tgid)
         {
-            auto processInformationIterator = processInformationByPid.find(taskStructIterator->second);
-            if (processInformationIterator == processInformationByPid.end())
+            std::scoped_lock processTableUpdateLock(processTableUpdateMutex);
+            auto currentProcessTable = std::atomic_load(&processTable);
+            if (currentProcessTable->findByPid(tgid))
             {
-                logger->warning("Process information not found for process",
-                                {{"taskStruct", fmt::format("{:#x}", taskStruct)},
-                                 {"ProcessId", static_cast<uint64_t>(taskStructIterator->second)}});
+                logger->debug("Discovered thread",
+                              {{"ThreadId", static_cast<uint64_t>(pid)},
+                               {"ProcessId", static_cast<uint64_t>(tgid)},
+                               {"taskStruct", fmt::format("{:#x}", taskStruct)}});
+                std::atomic_store(&processTable, currentProcessTable->withThread(taskStruct, tgid, pid));
+                return;
             }
-            else
-            {
-                std::string parentPid("unknownParentPid");
-                std::string parentName("unknownParentName");
-                std::string parentDtb("unknownParentDtb");
-                auto parentProcessInformation =
-                    processInformationByPid.find(processInformationIterator->second->parentPid);
-                if (parentProcessInformation != processInformationByPid.end())
-                {
-                    parentPid = std::to_string(parentProcessInformation->second->pid);
-                    parentName = parentProcessInformation->second->name;
-                    parentDtb = fmt::format("{:#x}", parentProcessInformation->second->processDtb);
-                }
+        }
 
-                eventStream->sendProcessEvent(::grpc::ProcessState::Terminated,
-                                              processInformationIterator->second->name,
-                                              static_cast<uint32_t>(processInformationIterator->second->pid),
-                                              fmt::format("{:#x}", processInformationIterator->second->processDtb));
-                logger->info(
-                    "Remove process from actives processes",
-                    {{"ProcessName", processInformationIterator->second->name},
-                     {"ProcessId", static_cast<uint64_t>(processInformationIterator->second->pid)},
-                     {"ProcessDtb", fmt::format("{:#x}", processInformationIterator->second->processDtb)},
-                     {"ProcessUserDtb", fmt::format("{:#x}", processInformationIterator->second->processUserDtb)},
-                     {"ParentProcessName", parentName},
-                     {"ParentProcessId", parentPid},
-                     {"ParentProcessDtb", parentDtb}});
-
-                processInformationByPid.erase(processInformationIterator);
-            }
-            pidsByTaskStruct.erase(taskStructIterator);
+        std::shared_ptr<ActiveProcessInformation> processInformation(extractProcessInformation(taskStruct));
+        std::shared_ptr<const ActiveProcessInformation> parentProcessInformation;
+        {
+            std::scoped_lock processTableUpdateLock(processTableUpdateMutex);
+            auto currentProcessTable = std::atomic_load(&processTable);
+            parentProcessInformation = currentProcessTable->findByPid(processInformation->parentPid);
+            std::atomic_store(&processTable, currentProcessTable->withProcess(processInformation, true));
         }
-        else
+
+        processEventDispatcher->post(
+            [this,
+             processInformation = std::move(processInformation),
+             parentProcessInformation = std::move(parentProcessInformation)]()
+            {
+                announceProcessEvent(::grpc::ProcessState::Started,
+                                     "Discovered active process",
+                                     *processInformation,
+                                     parentProcessInformation.get());
+            });
+    }
+
+    void ActiveProcessesSupervisor::removeActiveProcess(uint64_t taskStruct)
+    {
+        std::scoped_lock processTableUpdateLock(processTableUpdateMutex);
+        auto currentProcessTable = std::atomic_load(&processTable);
+        auto pid = currentProcessTable->findPidByBase(taskStruct);
+        if (!pid)
         {
             logger->warning("Process does not seem to be stored as an active process",
                             {{"taskStruct", fmt::format("{:#x}", taskStruct)}});
+            return;
         }
+
+        auto processInformation = currentProcessTable->findByPid(*pid);
+        auto updatedProcessTable = currentProcessTable->withoutProcess(taskStruct);
+        // The process lives on as long as any of its threads does, even if the thread group leader has exited
+        if (processInformation && updatedProcessTable->findByPid(*pid))
+        {
+            logger->debug("Remove thread",
+                          {{"ProcessId", static_cast<uint64_t>(*pid)},
+                           {"taskStruct", fmt::format("{:#x}", taskStruct)}});
+        }
+        else if (processInformation)
+        {
+            // The dentries of the executable may be reclaimed after the process is gone, so a path that is still
+            // pending has to be resolved before the guest continues
+            [[maybe_unused]] const auto& processPath = processInformation->processPath.get();
+            processEventDispatcher->post(
+                [this,
+                 processInformation,
+                 parentProcessInformation = currentProcessTable->findByPid(processInformation->parentPid)]()
+                {
+                    announceProcessEvent(::grpc::ProcessState::Terminated,
+                                         "Remove process from actives processes",
+                                         *processInformation,
+                                         parentProcessInformation.get());
+                });
+        }
+        else
+        {
+            logger->warning("Process information not found for process",
+                            {{"taskStruct", fmt::format("{:#x}", taskStruct)},
+                             {"ProcessId", static_cast<uint64_t>(*pid)}});
+        }
+
+        std::atomic_store(&processTable, std::move(updatedProcessTable));
     }
 
-    std::unique_ptr<std::vector<std::shared_ptr<const ActiveProcessInformation>>>
-    ActiveProcessesSupervisor::getActiveProcesses() const
+    void ActiveProcessesSupervisor::announceProcessEvent(::grpc::ProcessState processState,
+                                                         std::string_view message,
+                                                         const ActiveProcessInformation& processInformation,
+                                                         const ActiveProcessInformation* parentProcessInformation) const
     {
-        auto runningProcesses = std::make_unique<std::vector<std::shared_ptr<const ActiveProcessInformation>>>();
-        for (const auto& element : processInformationByPid)
+        std::string parentPid("unknownParentPid");
+        std::string parentName("unknownParentName");
+        std::string parentDtb("unknownParentDtb");
+        if (parentProcessInformation)
         {
-            runningProcesses->push_back(element.second);
+            parentPid = std::to_string(parentProcessInformation->pid);
+            parentName = parentProcessInformation->name;
+            parentDtb = fmt::format("{:#x}", parentProcessInformation->processDtb);
         }
-        return runningProcesses;
+
+        eventStream->sendProcessEvent(processState,
+                                      processInformation.name,
+                                      static_cast<uint32_t>(processInformation.pid),
+                                      fmt::format("{:#x}", processInformation.processDtb));
+        logger->info(message,
+                     {{"ProcessName", processInformation.name},
+                      {"ProcessId", static_cast<uint64_t>(processInformation.pid)},
+                      {"ProcessDtb", fmt::format("{:#x}", processInformation.processDtb)},
+                      {"ProcessUserDtb", fmt::format("{:#x}", processInformation.processUserDtb)},
+                      {"ParentProcessName", parentName},
+                      {"ParentProcessId", parentPid},
+                      {"ParentProcessDtb", parentDtb}});
     }
 
-    std::unique_ptr<std::string> ActiveProcessesSupervisor::splitProcessFileNameFromPath(const std::string& path) const
+    std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>>
+    ActiveProcessesSupervisor::getActiveProcesses() const
+    {
+        return std::atomic_load(&processTable)->getActiveProcesses();
+    }
+
+    std::unique_ptr<std::string> ActiveProcessesSupervisor::splitProcessFileNameFromPath(const std::string& path)
     {
         auto substringStartIterator =
             std::find_if(path.crbegin(), path.crend(), [](const char c) { return c == '/'; }).base();
@@ -232,23 +372,4 @@ namespace VmiCore::Linux
         }
         return std::make_unique<std::string>(substringStartIterator, path.cend());
     }
-
-    std::tuple<int, int, int> ActiveProcessesSupervisor::extractKernelVersion() const
-    {
-        auto banner = vmiInterface->extractStringAtVA(vmiInterface->translateKernelSymbolToVA("linux_banner"),
-                                                      vmiInterface->convertPidToDtb(SYSTEM_PID));
-        logger->debug("Banner extracted", {{"Banner", *banner}});
-
-        std::smatch matches;
-        if (!std::regex_search(*banner, matches, kernelBannerVersionMatcher))
-        {
-            throw std::runtime_error("Unexpected content in kernel banner");
-        }
-        if (matches.size() < 4)
-        {
-            throw std::runtime_error("Unable to retrieve version from kernel banner");
-        }
-
-        return {std::stoi(matches[1].str()), std::stoi(matches[2].str()), std::stoi(matches[3].str())};
-    }
 }
@@ -5,10 +5,16 @@
 #include "../../io/ILogging.h"
 #include "../../vmi/LibvmiInterface.h"
 #include "../IActiveProcessesSupervisor.h"
+#include "../ProcessEventDispatcher.h"
+#include "../ProcessTable.h"
+#include "DentryPathCache.h"
+#include "KernelOffsets.h"
+#include "KernelProfile.h"
 #include "PathExtractor.h"
-#include <map>
+#include <atomic>
+#include <future>
 #include <memory>
-#include <regex>
+#include <mutex>
 #include <vmicore/io/ILogger.h>
 
 namespace VmiCore::Linux
@@ -29,11 +35,13 @@ namespace VmiCore::Linux
         [[nodiscard]] std::shared_ptr<ActiveProcessInformation>
         getProcessInformationByBase(uint64_t taskStruct) const override;
 
+        [[nodiscard]] std::optional<ThreadInformation> getThreadInformationByBase(uint64_t taskStruct) const override;
+
         void addNewProcess(uint64_t taskStruct) override;
 
         void removeActiveProcess(uint64_t taskStruct) override;
 
-        [[nodiscard]] std::unique_ptr<std::vector<std::shared_ptr<const ActiveProcessInformation>>>
+        [[nodiscard]] std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>>
         getActiveProcesses() const override;
 
       private:
@@ -41,19 +49,37 @@ namespace VmiCore::Linux
         std::shared_ptr<ILogging> logging;
         std::unique_ptr<ILogger> logger;
         std::shared_ptr<IEventStream> eventStream;
+        std::shared_ptr<const KernelOffsets> kernelOffsets;
+        std::shared_ptr<DentryPathCache> pathCache = std::make_shared<DentryPathCache>();
         PathExtractor pathExtractor;
-        std::map<pid_t, std::shared_ptr<ActiveProcessInformation>> processInformationByPid;
-        std::map<uint64_t, pid_t> pidsByTaskStruct;
-        std::regex kernelBannerVersionMatcher{R"(Linux version ([0-9]+)\.([0-9]+)\.([0-9]+))"};
-        bool pti = false;
+        // Published and read with std::atomic_store/std::atomic_load, std::atomic<std::shared_ptr> is not supported by
+        // all standard libraries yet
+        std::shared_ptr<const ProcessTable> processTable = std::make_shared<const ProcessTable>();
+        std::mutex processTableUpdateMutex;
+        std::shared_ptr<const KernelProfile> kernelProfile;
+        // Declared last so that pending events are processed before any other member is destroyed
+        std::unique_ptr<ProcessEventDispatcher> processEventDispatcher;
 
         [[nodiscard]] std::unique_ptr<ActiveProcessInformation> extractProcessInformation(uint64_t taskStruct);
 
+        void addThreadsOf(uint64_t taskStruct);
+
+        void announceProcessEvent(::grpc::ProcessState processState,
+                                  std::string_view message,
+                                  const ActiveProcessInformation& processInformation,
+                                  const ActiveProcessInformation* parentProcessInformation) const;
+
         [[nodiscard]] pid_t extractPid(uint64_t taskStruct) const;
 
-        [[nodiscard]] std::unique_ptr<std::string> splitProcessFileNameFromPath(const std::string& path) const;
+        [[nodiscard]] pid_t extractTgid(uint64_t taskStruct) const;
+
+        [[nodiscard]] std::shared_future<std::string>
+        deferProcessPathExtraction(uint64_t mm, pid_t pid, const std::string& name);
+
+        [[nodiscard]] std::string
+        tryExtractProcessPath(const DPath& executable, pid_t pid, const std::string& name) const;
 
-        [[nodiscard]] std::tuple<int, int, int> extractKernelVersion() const;
+        [[nodiscard]] static std::unique_ptr<std::string> splitProcessFileNameFromPath(const std::string& path);
     };
 }
 
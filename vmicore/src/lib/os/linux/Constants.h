@@ -7,6 +7,28 @@ namespace VmiCore::Linux
     constexpr uint16_t USER_DTB_OFFSET = 0x1000;
     constexpr auto PTI_FEATURE_ARRAY_ENTRY_OFFSET = 7 * sizeof(uint32_t);
     constexpr uint64_t PTI_FEATURE_MASK = 1ULL << 11;
+    // Upper bound for the number of dentries walked when extracting a path, protects against dentry loops
+    constexpr std::size_t PATH_COMPONENTS_MAX = 256;
+    // Maximum number of pending process events before process creation and removal start to block
+    constexpr std::size_t PROCESS_EVENT_QUEUE_CAPACITY = 1024;
+
+    // Maple tree layout on 64 bit kernels, see include/linux/maple_tree.h
+    constexpr std::size_t MAPLE_NODE_SIZE = 256;
+    constexpr uint64_t MAPLE_NODE_MASK = 0xFF;
+    constexpr uint64_t MAPLE_NODE_TYPE_SHIFT = 0x03;
+    constexpr uint64_t MAPLE_NODE_TYPE_MASK = 0x0F;
+    constexpr std::size_t MAPLE_RANGE64_SLOTS = 16;
+    constexpr std::size_t MAPLE_ARANGE64_SLOTS = 10;
+    // Maximum height of a maple tree
+    constexpr std::size_t MAPLE_HEIGHT_MAX = 31;
+
+    enum class MapleType : uint64_t
+    {
+        maple_dense = 0,
+        maple_leaf_64 = 1,
+        maple_range_64 = 2,
+        maple_arange_64 = 3
+    };
 }
 
 #endif // VMICORE_LINUX_CONSTANTS_H
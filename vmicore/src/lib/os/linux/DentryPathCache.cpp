@@ -0,0 +1,64 @@
+#include "DentryPathCache.h"
+#include <functional>
+
+namespace VmiCore::Linux
+{
+    std::optional<std::string> DentryPathCache::find(uint64_t dentry,
+                                                     uint64_t mnt,
+                                                     const DentryValidationToken& validationToken,
+                                                     uint32_t renameSequence)
+    {
+        std::scoped_lock guard(lock);
+        startOverOnRename(renameSequence);
+        auto entry = entries.find({.dentry = dentry, .mnt = mnt});
+        if (entry == entries.end())
+        {
+            return std::nullopt;
+        }
+        if (entry->second.validationToken != validationToken)
+        {
+            entries.erase(entry);
+            return std::nullopt;
+        }
+
+        return entry->second.path;
+    }
+
+    void DentryPathCache::insert(uint64_t dentry,
+                                 uint64_t mnt,
+                                 const DentryValidationToken& validationToken,
+                                 uint32_t renameSequence,
+                                 std::string path)
+    {
+        std::scoped_lock guard(lock);
+        startOverOnRename(renameSequence);
+        // Dentries of closed files are never evicted explicitly, so start over instead of growing without bounds
+        if (entries.size() >= maxEntries)
+        {
+            entries.clear();
+        }
+        entries.insert_or_assign({.dentry = dentry, .mnt = mnt},
+                                 Entry{.validationToken = validationToken, .path = std::move(path)});
+    }
+
+    std::size_t DentryPathCache::size() const
+    {
+        std::scoped_lock guard(lock);
+        return entries.size();
+    }
+
+    void DentryPathCache::startOverOnRename(uint32_t currentRenameSequence)
+    {
+        // Any rename may have changed the path of an arbitrary entry, so none of them can be trusted anymore
+        if (currentRenameSequence != renameSequence)
+        {
+            entries.clear();
+            renameSequence = currentRenameSequence;
+        }
+    }
+
+    std::size_t DentryPathCache::KeyHash::operator()(const Key& key) const
+    {
+        return std::hash<uint64_t>{}(key.dentry) ^ (std::hash<uint64_t>{}(key.mnt) << 1);
+    }
+}
@@ -0,0 +1,81 @@
+#ifndef VMICORE_LINUX_DENTRYPATHCACHE_H
+#define VMICORE_LINUX_DENTRYPATHCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace VmiCore::Linux
+{
+    /**
+     * Values read from a dentry which change whenever it is renamed, moved or reused for a different file. The name
+     * pointer alone is insufficient as short names are stored inline, and d_seq is reset when a dentry is reallocated,
+     * therefore the parent and inode are part of the token as well.
+     */
+    struct DentryValidationToken
+    {
+        uint64_t nameAddress;
+        uint64_t parent;
+        uint64_t inode;
+        uint32_t sequence;
+
+        bool operator==(const DentryValidationToken&) const = default;
+    };
+
+    /**
+     * Caches resolved paths keyed by dentry and mount address. Every path component is cached separately, so resolving
+     * a file whose parent directory has been seen before only requires reading its own name and the parent's token.
+     * An entry is valid as long as the dentry's validation token is unchanged and no dentry has been renamed or moved
+     * since it was inserted. The latter is tracked by the kernel's global rename sequence, which is why ancestors
+     * above a cached dentry do not have to be validated individually. A new rename sequence drops all entries.
+     */
+    class DentryPathCache
+    {
+      public:
+        static constexpr std::size_t maxEntries = 0x10000;
+
+        [[nodiscard]] std::optional<std::string> find(uint64_t dentry,
+                                                      uint64_t mnt,
+                                                      const DentryValidationToken& validationToken,
+                                                      uint32_t renameSequence);
+
+        void insert(uint64_t dentry,
+                    uint64_t mnt,
+                    const DentryValidationToken& validationToken,
+                    uint32_t renameSequence,
+                    std::string path);
+
+        [[nodiscard]] std::size_t size() const;
+
+      private:
+        struct Key
+        {
+            uint64_t dentry;
+            uint64_t mnt;
+
+            bool operator==(const Key&) const = default;
+        };
+
+        struct KeyHash
+        {
+            std::size_t operator()(const Key& key) const;
+        };
+
+        struct Entry
+        {
+            DentryValidationToken validationToken;
+            std::string path;
+        };
+
+        mutable std::mutex lock;
+        uint32_t renameSequence = 0;
+        std::unordered_map<Key, Entry, KeyHash> entries;
+
+        void startOverOnRename(uint32_t currentRenameSequence);
+    };
+}
+
+#endif // VMICORE_LINUX_DENTRYPATHCACHE_H
@@ -0,0 +1,26 @@
+#ifndef VMICORE_LINUX_IVMAREAWALKER_H
+#define VMICORE_LINUX_IVMAREAWALKER_H
+
+#include <cstdint>
+#include <vector>
+#include <vmicore/types.h>
+
+namespace VmiCore::Linux
+{
+    /**
+     * Enumerates the vm_area_structs of an address space. The implementation matching the kernel's memory management
+     * layout is selected once by the KernelProfile.
+     */
+    class IVmAreaWalker
+    {
+      public:
+        virtual ~IVmAreaWalker() = default;
+
+        [[nodiscard]] virtual std::vector<addr_t> collectVmAreas(uint64_t mm) const = 0;
+
+      protected:
+        IVmAreaWalker() = default;
+    };
+}
+
+#endif // VMICORE_LINUX_IVMAREAWALKER_H
@@ -0,0 +1,96 @@
+#include "KernelOffsets.h"
+#include <fmt/core.h>
+#include <source_location>
+#include <vmicore/vmi/VmiException.h>
+
+namespace VmiCore::Linux
+{
+    namespace
+    {
+        std::optional<addr_t> tryGetKernelStructOffset(const std::shared_ptr<ILibvmiInterface>& vmiInterface,
+                                                       const std::string& structName,
+                                                       const std::string& member)
+        {
+            try
+            {
+                return vmiInterface->getKernelStructOffset(structName, member);
+            }
+            catch (const VmiException&)
+            {
+                return std::nullopt;
+            }
+        }
+
+        std::optional<addr_t> tryTranslateKernelSymbolToVA(const std::shared_ptr<ILibvmiInterface>& vmiInterface,
+                                                           const std::string& kernelSymbolName)
+        {
+            try
+            {
+                return vmiInterface->translateKernelSymbolToVA(kernelSymbolName);
+            }
+            catch (const VmiException&)
+            {
+                return std::nullopt;
+            }
+        }
+    }
+
+    KernelOffsets KernelOffsets::init(const std::shared_ptr<ILibvmiInterface>& vmiInterface)
+    {
+        if (!vmiInterface->isInitialized())
+        {
+            throw std::invalid_argument(fmt::format("{}: Aborting, vmiInterface not initialized yet.",
+                                                    std::source_location::current().function_name()));
+        }
+
+        KernelOffsets kernelOffsets{
+            .libvmi = {.tasks = vmiInterface->getOffset("linux_tasks"),
+                       .pgd = vmiInterface->getOffset("linux_pgd"),
+                       .name = vmiInterface->getOffset("linux_name"),
+                       .pid = vmiInterface->getOffset("linux_pid")},
+            .taskStruct = {.mm = vmiInterface->getKernelStructOffset("task_struct", "mm"),
+                           .real_parent = vmiInterface->getKernelStructOffset("task_struct", "real_parent"),
+                           .tgid = vmiInterface->getKernelStructOffset("task_struct", "tgid")},
+            .mmStruct = {.exe_file = vmiInterface->getKernelStructOffset("mm_struct", "exe_file"),
+                         .mmap = tryGetKernelStructOffset(vmiInterface, "mm_struct", "mmap"),
+                         .mm_mt = tryGetKernelStructOffset(vmiInterface, "mm_struct", "mm_mt")},
+            .vmAreaStruct = {.size = vmiInterface->getStructSizeFromJson("vm_area_struct"),
+                             .vm_start = vmiInterface->getKernelStructOffset("vm_area_struct", "vm_start"),
+                             .vm_end = vmiInterface->getKernelStructOffset("vm_area_struct", "vm_end"),
+                             .vm_flags = vmiInterface->getKernelStructOffset("vm_area_struct", "vm_flags"),
+                             .vm_file = vmiInterface->getKernelStructOffset("vm_area_struct", "vm_file"),
+                             .vm_next = tryGetKernelStructOffset(vmiInterface, "vm_area_struct", "vm_next")},
+            .file = {.f_path = vmiInterface->getKernelStructOffset("file", "f_path")},
+            .path = {.mnt = vmiInterface->getKernelStructOffset("path", "mnt"),
+                     .dentry = vmiInterface->getKernelStructOffset("path", "dentry")},
+            .mount = {.mnt = vmiInterface->getKernelStructOffset("mount", "mnt"),
+                      .mnt_mountpoint = vmiInterface->getKernelStructOffset("mount", "mnt_mountpoint"),
+                      .mnt_parent = vmiInterface->getKernelStructOffset("mount", "mnt_parent")},
+            .dentry = {.d_name = vmiInterface->getKernelStructOffset("dentry", "d_name"),
+                       .d_parent = vmiInterface->getKernelStructOffset("dentry", "d_parent"),
+                       .d_inode = vmiInterface->getKernelStructOffset("dentry", "d_inode"),
+                       .d_seq = tryGetKernelStructOffset(vmiInterface, "dentry", "d_seq")},
+            .qstr = {.name = vmiInterface->getKernelStructOffset("qstr", "name")},
+            .renameLockVA = tryTranslateKernelSymbolToVA(vmiInterface, "rename_lock")};
+
+        if (kernelOffsets.mmStruct.mm_mt)
+        {
+            kernelOffsets.mapleTree = {
+                .ma_root = vmiInterface->getKernelStructOffset("maple_tree", "ma_root"),
+                .range64Pivot = vmiInterface->getKernelStructOffset("maple_range_64", "pivot"),
+                .range64Slot = vmiInterface->getKernelStructOffset("maple_range_64", "slot"),
+                .arange64Pivot = vmiInterface->getKernelStructOffset("maple_arange_64", "pivot"),
+                .arange64Slot = vmiInterface->getKernelStructOffset("maple_arange_64", "slot")};
+        }
+
+        if (auto threadHead = tryGetKernelStructOffset(vmiInterface, "signal_struct", "thread_head"))
+        {
+            kernelOffsets.threadGroup = {
+                .signal = vmiInterface->getKernelStructOffset("task_struct", "signal"),
+                .thread_head = *threadHead,
+                .thread_node = vmiInterface->getKernelStructOffset("task_struct", "thread_node")};
+        }
+
+        return kernelOffsets;
+    }
+}
@@ -0,0 +1,121 @@
+#ifndef VMICORE_LINUX_KERNELOFFSETS_H
+#define VMICORE_LINUX_KERNELOFFSETS_H
+
+#include "../../vmi/LibvmiInterface.h"
+#include <memory>
+#include <optional>
+
+namespace VmiCore::Linux
+{
+    namespace KernelStructOffsets
+    {
+        // Offsets that are part of the libvmi configuration rather than the kernel profile
+        using libvmi_offsets = struct libvmi_offsets
+        {
+            addr_t tasks;
+            addr_t pgd;
+            addr_t name;
+            addr_t pid;
+        } __attribute__((aligned(32)));
+
+        using task_struct = struct task_struct
+        {
+            addr_t mm;
+            addr_t real_parent;
+            addr_t tgid;
+        } __attribute__((aligned(32)));
+
+        // List of all threads of a process, anchored in the shared signal_struct. Present since Linux 3.14
+        using thread_group = struct thread_group
+        {
+            addr_t signal;
+            addr_t thread_head;
+            addr_t thread_node;
+        } __attribute__((aligned(32)));
+
+        using mm_struct = struct mm_struct
+        {
+            addr_t exe_file;
+            // Head of the vma list, removed in favor of the maple tree mm_mt in Linux 6.1
+            std::optional<addr_t> mmap;
+            std::optional<addr_t> mm_mt;
+        } __attribute__((aligned(64)));
+
+        using vm_area_struct = struct vm_area_struct
+        {
+            std::size_t size;
+            addr_t vm_start;
+            addr_t vm_end;
+            addr_t vm_flags;
+            addr_t vm_file;
+            // Removed in favor of the maple tree in Linux 6.1
+            std::optional<addr_t> vm_next;
+        } __attribute__((aligned(64)));
+
+        using maple_tree = struct maple_tree
+        {
+            addr_t ma_root;
+            addr_t range64Pivot;
+            addr_t range64Slot;
+            addr_t arange64Pivot;
+            addr_t arange64Slot;
+        } __attribute__((aligned(64)));
+
+        using file = struct file
+        {
+            addr_t f_path;
+        };
+
+        using path = struct path
+        {
+            addr_t mnt;
+            addr_t dentry;
+        } __attribute__((aligned(16)));
+
+        using mount = struct mount
+        {
+            addr_t mnt;
+            addr_t mnt_mountpoint;
+            addr_t mnt_parent;
+        } __attribute__((aligned(32)));
+
+        using dentry = struct dentry
+        {
+            addr_t d_name;
+            addr_t d_parent;
+            addr_t d_inode;
+            std::optional<addr_t> d_seq;
+        } __attribute__((aligned(32)));
+
+        using qstr = struct qstr
+        {
+            addr_t name;
+        };
+    } // namespace KernelStructOffsets
+
+    /**
+     * Kernel structure offsets needed for process and memory region extraction. Resolving these from the kernel
+     * profile requires a locked lookup in libvmi, therefore they are resolved only once and reused afterwards.
+     */
+    class KernelOffsets
+    {
+      public:
+        static KernelOffsets init(const std::shared_ptr<ILibvmiInterface>& vmiInterface);
+
+        KernelStructOffsets::libvmi_offsets libvmi{};
+        KernelStructOffsets::task_struct taskStruct{};
+        std::optional<KernelStructOffsets::thread_group> threadGroup{};
+        KernelStructOffsets::mm_struct mmStruct{};
+        KernelStructOffsets::vm_area_struct vmAreaStruct{};
+        std::optional<KernelStructOffsets::maple_tree> mapleTree{};
+        KernelStructOffsets::file file{};
+        KernelStructOffsets::path path{};
+        KernelStructOffsets::mount mount{};
+        KernelStructOffsets::dentry dentry{};
+        KernelStructOffsets::qstr qstr{};
+        // Address of the rename_lock seqlock, whose sequence count changes whenever any dentry is renamed or moved
+        std::optional<addr_t> renameLockVA{};
+    };
+}
+
+#endif // VMICORE_LINUX_KERNELOFFSETS_H
@@ -0,0 +1,66 @@
+#include "KernelProfile.h"
+#include "Constants.h"
+#include "MapleTreeWalker.h"
+#include "VmAreaListWalker.h"
+#include <regex>
+#include <stdexcept>
+#include <string>
+
+namespace VmiCore::Linux
+{
+    namespace
+    {
+        constexpr KernelVersion firstPtiVersion{.major = 4, .minor = 15, .patch = 0};
+        constexpr KernelVersion firstMapleTreeVersion{.major = 6, .minor = 1, .patch = 0};
+    }
+
+    KernelProfile KernelProfile::init(const std::shared_ptr<ILibvmiInterface>& vmiInterface,
+                                      const KernelOffsets& kernelOffsets)
+    {
+        KernelProfile kernelProfile{};
+        kernelProfile.version =
+            parseKernelVersion(*vmiInterface->extractStringAtVA(vmiInterface->translateKernelSymbolToVA("linux_banner"),
+                                                                vmiInterface->convertPidToDtb(SYSTEM_PID)));
+
+        // Backports of PTI to older LTS releases are currently ignored
+        if (kernelProfile.version >= firstPtiVersion)
+        {
+            auto x86CapabilityOffset = vmiInterface->getKernelStructOffset("cpuinfo_x86", "x86_capability");
+            // X86_FEATURE_PTI is defined as 7*32+11
+            auto x86CapabilityEntry = vmiInterface->read32VA(vmiInterface->translateKernelSymbolToVA("boot_cpu_data") +
+                                                                 x86CapabilityOffset + PTI_FEATURE_ARRAY_ENTRY_OFFSET,
+                                                             vmiInterface->convertPidToDtb(SYSTEM_PID));
+            kernelProfile.pti = x86CapabilityEntry & PTI_FEATURE_MASK;
+        }
+
+        if (kernelProfile.version >= firstMapleTreeVersion)
+        {
+            kernelProfile.vmAreaWalker = std::make_shared<const MapleTreeWalker>(vmiInterface, kernelOffsets);
+        }
+        else
+        {
+            kernelProfile.vmAreaWalker = std::make_shared<const VmAreaListWalker>(vmiInterface, kernelOffsets);
+        }
+
+        return kernelProfile;
+    }
+
+    KernelVersion KernelProfile::parseKernelVersion(std::string_view banner)
+    {
+        static const std::regex kernelBannerVersionMatcher{R"(Linux version ([0-9]+)\.([0-9]+)\.([0-9]+))"};
+
+        std::match_results<std::string_view::const_iterator> matches;
+        if (!std::regex_search(banner.cbegin(), banner.cend(), matches, kernelBannerVersionMatcher))
+        {
+            throw std::runtime_error("Unexpected content in kernel banner");
+        }
+        if (matches.size() < 4)
+        {
+            throw std::runtime_error("Unable to retrieve version from kernel banner");
+        }
+
+        return {.major = std::stoi(matches[1].str()),
+                .minor = std::stoi(matches[2].str()),
+                .patch = std::stoi(matches[3].str())};
+    }
+}
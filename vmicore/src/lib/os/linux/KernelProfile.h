@@ -0,0 +1,45 @@
+#ifndef VMICORE_LINUX_KERNELPROFILE_H
+#define VMICORE_LINUX_KERNELPROFILE_H
+
+#include "../../vmi/LibvmiInterface.h"
+#include "IVmAreaWalker.h"
+#include "KernelOffsets.h"
+#include <compare>
+#include <memory>
+#include <string_view>
+
+namespace VmiCore::Linux
+{
+    struct KernelVersion
+    {
+        int major;
+        int minor;
+        int patch;
+
+        auto operator<=>(const KernelVersion&) const = default;
+    };
+
+    /**
+     * Version dependent properties of the guest kernel. Determined once during initialization so that extraction code
+     * does not need to branch on the kernel version or on the presence of optional kernel structures.
+     */
+    class KernelProfile
+    {
+      public:
+        /**
+         * Selects the decoding strategies for the running kernel:
+         * - 4.15 and newer may have kernel page table isolation enabled, which is queried from boot_cpu_data.
+         * - Up to 6.0 memory regions are kept in a vm_area_struct list, from 6.1 on in a maple tree.
+         */
+        static KernelProfile init(const std::shared_ptr<ILibvmiInterface>& vmiInterface,
+                                  const KernelOffsets& kernelOffsets);
+
+        [[nodiscard]] static KernelVersion parseKernelVersion(std::string_view banner);
+
+        KernelVersion version{};
+        bool pti = false;
+        std::shared_ptr<const IVmAreaWalker> vmAreaWalker;
+    };
+}
+
+#endif // VMICORE_LINUX_KERNELPROFILE_H
@@ -2,45 +2,60 @@
 #include "../PageProtection.h"
 #include "Constants.h"
 #include "ProtectionValues.h"
+#include <cstring>
 #include <vmicore/filename.h>
+#include <vmicore/vmi/VmiException.h>
 
 namespace VmiCore::Linux
 {
+    namespace
+    {
+        uint64_t readUint64(const std::vector<uint8_t>& buffer, std::size_t offset)
+        {
+            uint64_t value = 0;
+            std::memcpy(&value, buffer.data() + offset, sizeof(value));
+            return value;
+        }
+    }
+
     MMExtractor::MMExtractor(std::shared_ptr<ILibvmiInterface> vmiInterface,
+                             std::shared_ptr<const KernelOffsets> kernelOffsets,
+                             std::shared_ptr<const IVmAreaWalker> vmAreaWalker,
+                             std::shared_ptr<DentryPathCache> pathCache,
                              const std::shared_ptr<ILogging>& logging,
                              uint64_t mm)
         : vmiInterface(std::move(vmiInterface)),
+          kernelOffsets(std::move(kernelOffsets)),
+          vmAreaWalker(std::move(vmAreaWalker)),
           logger(logging->newNamedLogger(FILENAME_STEM)),
-          pathExtractor(this->vmiInterface, logging),
-          mm(mm)
+          pathExtractor(this->vmiInterface, this->kernelOffsets, std::move(pathCache), logging),
+          mm(mm),
+          systemDtb(this->vmiInterface->convertPidToDtb(SYSTEM_PID))
     {
     }
 
     std::unique_ptr<std::vector<MemoryRegion>> MMExtractor::extractAllMemoryRegions() const
     {
+        const auto& vmAreaStruct = kernelOffsets->vmAreaStruct;
+        const auto areas = vmAreaWalker->collectVmAreas(mm);
+
         auto regions = std::make_unique<std::vector<MemoryRegion>>();
+        regions->reserve(areas.size());
+        std::vector<uint8_t> areaBuffer(vmAreaStruct.size);
 
-        for (auto area = vmiInterface->read64VA(mm, vmiInterface->convertPidToDtb(SYSTEM_PID)); area != 0;
-             area = vmiInterface->read64VA(area + vmiInterface->getKernelStructOffset("vm_area_struct", "vm_next"),
-                                           vmiInterface->convertPidToDtb(SYSTEM_PID)))
+        for (const auto area : areas)
         {
-            const auto start =
-                vmiInterface->read64VA(area + vmiInterface->getKernelStructOffset("vm_area_struct", "vm_start"),
-                                       vmiInterface->convertPidToDtb(SYSTEM_PID));
-            const auto end =
-                vmiInterface->read64VA(area + vmiInterface->getKernelStructOffset("vm_area_struct", "vm_end"),
-                                       vmiInterface->convertPidToDtb(SYSTEM_PID));
+            readGuestMemory(area, areaBuffer, vmAreaStruct.size);
+
+            const auto start = readUint64(areaBuffer, vmAreaStruct.vm_start);
+            const auto end = readUint64(areaBuffer, vmAreaStruct.vm_end);
             const auto size = end - start + 1;
-            const auto flags =
-                vmiInterface->read64VA(area + vmiInterface->getKernelStructOffset("vm_area_struct", "vm_flags"),
-                                       vmiInterface->convertPidToDtb(SYSTEM_PID));
-            const auto file =
-                vmiInterface->read64VA(area + vmiInterface->getKernelStructOffset("vm_area_struct", "vm_file"),
-                                       vmiInterface->convertPidToDtb(SYSTEM_PID));
+            const auto flags = readUint64(areaBuffer, vmAreaStruct.vm_flags);
+            const auto file = readUint64(areaBuffer, vmAreaStruct.vm_file);
             std::string fileName{};
             if (file != 0)
             {
-                fileName = pathExtractor.extractDPath(file + vmiInterface->getKernelStructOffset("file", "f_path"));
+                fileName = pathExtractor.extractDPath(file + kernelOffsets->file.f_path);
             }
 
             auto permissions = std::make_unique<PageProtection>(flags, OperatingSystem::LINUX);
@@ -62,4 +77,12 @@ namespace VmiCore::Linux
 
         return regions;
     }
+
+    void MMExtractor::readGuestMemory(addr_t virtualAddress, std::vector<uint8_t>& buffer, std::size_t size) const
+    {
+        if (!vmiInterface->readXVA(virtualAddress, systemDtb, buffer, size))
+        {
+            throw VmiException(fmt::format("{}: Unable to read {} bytes at {:#x}", __func__, size, virtualAddress));
+        }
+    }
 }
@@ -3,9 +3,12 @@
 
 #include "../../io/ILogging.h"
 #include "../../vmi/LibvmiInterface.h"
+#include "IVmAreaWalker.h"
+#include "KernelOffsets.h"
 #include "PathExtractor.h"
 #include <vmicore/io/ILogger.h>
 #include <vmicore/os/IMemoryRegionExtractor.h>
+#include <vector>
 
 namespace VmiCore::Linux
 {
@@ -13,6 +16,9 @@ namespace VmiCore::Linux
     {
       public:
         MMExtractor(std::shared_ptr<ILibvmiInterface> vmiInterface,
+                    std::shared_ptr<const KernelOffsets> kernelOffsets,
+                    std::shared_ptr<const IVmAreaWalker> vmAreaWalker,
+                    std::shared_ptr<DentryPathCache> pathCache,
                     const std::shared_ptr<ILogging>& logging,
                     uint64_t mm);
 
@@ -20,9 +26,14 @@ namespace VmiCore::Linux
 
       private:
         std::shared_ptr<ILibvmiInterface> vmiInterface;
+        std::shared_ptr<const KernelOffsets> kernelOffsets;
+        std::shared_ptr<const IVmAreaWalker> vmAreaWalker;
         std::unique_ptr<ILogger> logger;
         PathExtractor pathExtractor;
         uint64_t mm;
+        addr_t systemDtb;
+
+        void readGuestMemory(addr_t virtualAddress, std::vector<uint8_t>& buffer, std::size_t size) const;
     };
 }
 
@@ -0,0 +1,124 @@
+#include "MapleTreeWalker.h"
+#include "Constants.h"
+#include <cstring>
+#include <fmt/core.h>
+#include <limits>
+#include <vmicore/vmi/VmiException.h>
+
+namespace VmiCore::Linux
+{
+    namespace
+    {
+        uint64_t readUint64(const std::vector<uint8_t>& buffer, std::size_t offset)
+        {
+            uint64_t value = 0;
+            std::memcpy(&value, buffer.data() + offset, sizeof(value));
+            return value;
+        }
+
+        // Internal maple nodes are tagged pointers with the second lowest bit set, see xa_is_node()
+        bool isMapleNode(uint64_t entry)
+        {
+            return (entry & 3) == 2 && entry > 4096;
+        }
+    }
+
+    MapleTreeWalker::MapleTreeWalker(std::shared_ptr<ILibvmiInterface> vmiInterface, const KernelOffsets& kernelOffsets)
+        : vmiInterface(std::move(vmiInterface)), systemDtb(this->vmiInterface->convertPidToDtb(SYSTEM_PID))
+    {
+        if (!kernelOffsets.mmStruct.mm_mt || !kernelOffsets.mapleTree)
+        {
+            throw VmiException(fmt::format("{}: Kernel profile lacks maple tree definitions", __func__));
+        }
+        rootOffset = *kernelOffsets.mmStruct.mm_mt + kernelOffsets.mapleTree->ma_root;
+        mapleTree = *kernelOffsets.mapleTree;
+    }
+
+    std::vector<addr_t> MapleTreeWalker::collectVmAreas(uint64_t mm) const
+    {
+        std::vector<addr_t> areas{};
+        const auto root = vmiInterface->read64VA(mm + rootOffset, systemDtb);
+
+        if (isMapleNode(root))
+        {
+            walkNode(root, 0, std::numeric_limits<uint64_t>::max(), 0, areas);
+        }
+        else if (root != 0)
+        {
+            // A tree holding a single range stores the entry directly in the root
+            areas.push_back(root);
+        }
+
+        return areas;
+    }
+
+    void MapleTreeWalker::walkNode(
+        uint64_t entry, uint64_t min, uint64_t max, std::size_t depth, std::vector<addr_t>& areas) const
+    {
+        if (depth > MAPLE_HEIGHT_MAX)
+        {
+            throw VmiException(fmt::format("{}: Maple tree exceeds maximum height", __func__));
+        }
+
+        const auto nodeAddress = entry & ~MAPLE_NODE_MASK;
+        const auto type = static_cast<MapleType>((entry >> MAPLE_NODE_TYPE_SHIFT) & MAPLE_NODE_TYPE_MASK);
+
+        std::size_t slotCount = 0;
+        addr_t pivotOffset = 0;
+        addr_t slotOffset = 0;
+        switch (type)
+        {
+            case MapleType::maple_leaf_64:
+            case MapleType::maple_range_64:
+                slotCount = MAPLE_RANGE64_SLOTS;
+                pivotOffset = mapleTree.range64Pivot;
+                slotOffset = mapleTree.range64Slot;
+                break;
+            case MapleType::maple_arange_64:
+                slotCount = MAPLE_ARANGE64_SLOTS;
+                pivotOffset = mapleTree.arange64Pivot;
+                slotOffset = mapleTree.arange64Slot;
+                break;
+            default:
+                throw VmiException(fmt::format(
+                    "{}: Unsupported maple node type {} at {:#x}", __func__, static_cast<uint64_t>(type), nodeAddress));
+        }
+
+        // Each node occupies a single cache line aligned block, so it is fetched as a whole and decoded locally
+        std::vector<uint8_t> node(MAPLE_NODE_SIZE);
+        if (!vmiInterface->readXVA(nodeAddress, systemDtb, node, MAPLE_NODE_SIZE))
+        {
+            throw VmiException(fmt::format("{}: Unable to read maple node at {:#x}", __func__, nodeAddress));
+        }
+
+        const auto isLeaf = type == MapleType::maple_leaf_64;
+        for (std::size_t i = 0; i < slotCount; i++)
+        {
+            const auto pivot = i < slotCount - 1 ? readUint64(node, pivotOffset + i * sizeof(uint64_t)) : max;
+            // A zero pivot beyond the first slot marks the end of the node's data
+            if (i > 0 && pivot == 0)
+            {
+                break;
+            }
+
+            const auto slot = readUint64(node, slotOffset + i * sizeof(uint64_t));
+            if (slot != 0)
+            {
+                if (!isLeaf)
+                {
+                    walkNode(slot, min, pivot, depth + 1, areas);
+                }
+                else if ((slot & 3) == 0)
+                {
+                    areas.push_back(slot);
+                }
+            }
+
+            if (pivot >= max)
+            {
+                break;
+            }
+            min = pivot + 1;
+        }
+    }
+}
@@ -0,0 +1,32 @@
+#ifndef VMICORE_LINUX_MAPLETREEWALKER_H
+#define VMICORE_LINUX_MAPLETREEWALKER_H
+
+#include "../../vmi/LibvmiInterface.h"
+#include "IVmAreaWalker.h"
+#include "KernelOffsets.h"
+#include <memory>
+
+namespace VmiCore::Linux
+{
+    /**
+     * Walks the maple tree rooted in mm_struct.mm_mt which replaced the vm_area_struct list in Linux 6.1. Every node is
+     * fetched with a single read and decoded locally.
+     */
+    class MapleTreeWalker final : public IVmAreaWalker
+    {
+      public:
+        MapleTreeWalker(std::shared_ptr<ILibvmiInterface> vmiInterface, const KernelOffsets& kernelOffsets);
+
+        [[nodiscard]] std::vector<addr_t> collectVmAreas(uint64_t mm) const override;
+
+      private:
+        std::shared_ptr<ILibvmiInterface> vmiInterface;
+        addr_t rootOffset;
+        KernelStructOffsets::maple_tree mapleTree;
+        addr_t systemDtb;
+
+        void walkNode(uint64_t entry, uint64_t min, uint64_t max, std::size_t depth, std::vector<addr_t>& areas) const;
+    };
+}
+
+#endif // VMICORE_LINUX_MAPLETREEWALKER_H
@@ -1,12 +1,33 @@
 #include "PathExtractor.h"
 #include "Constants.h"
+#include <array>
 #include <vmicore/filename.h>
+#include <vmicore/vmi/VmiException.h>
 
 namespace VmiCore::Linux
 {
+    namespace
+    {
+        struct PathComponent
+        {
+            uint64_t dentry;
+            uint64_t mnt;
+            DentryValidationToken validationToken;
+            // Filesystem roots and mount points do not contribute a name of their own
+            bool isMountRoot;
+            bool isFilesystemRoot;
+            std::size_t pathLength;
+        };
+    }
+
     PathExtractor::PathExtractor(std::shared_ptr<ILibvmiInterface> vmiInterface,
+                                 std::shared_ptr<const KernelOffsets> kernelOffsets,
+                                 std::shared_ptr<DentryPathCache> pathCache,
                                  const std::shared_ptr<ILogging>& logging)
-        : vmiInterface(std::move(vmiInterface)), logger(logging->newNamedLogger(FILENAME_STEM))
+        : vmiInterface(std::move(vmiInterface)),
+          kernelOffsets(std::move(kernelOffsets)),
+          pathCache(std::move(pathCache)),
+          logger(logging->newNamedLogger(FILENAME_STEM))
     {
     }
 
@@ -17,65 +38,160 @@ namespace VmiCore::Linux
             return {};
         }
 
-        const auto mnt = vmiInterface->read64VA(path + vmiInterface->getKernelStructOffset("path", "mnt"),
-                                                vmiInterface->convertPidToDtb(SYSTEM_PID));
-        const auto dentry = vmiInterface->read64VA(path + vmiInterface->getKernelStructOffset("path", "dentry"),
-                                                   vmiInterface->convertPidToDtb(SYSTEM_PID));
+        return extractDPath(readDPath(path));
+    }
+
+    DPath PathExtractor::readDPath(uint64_t path) const
+    {
+        return {.dentry = vmiInterface->read64VA(path + kernelOffsets->path.dentry,
+                                                 vmiInterface->convertPidToDtb(SYSTEM_PID)),
+                .mnt = vmiInterface->read64VA(path + kernelOffsets->path.mnt,
+                                              vmiInterface->convertPidToDtb(SYSTEM_PID))};
+    }
 
-        if (dentry == 0 || mnt == 0)
+    std::string PathExtractor::extractDPath(const DPath& dPath) const
+    {
+        if (dPath.dentry == 0 || dPath.mnt == 0)
         {
             return {};
         }
 
-        return createPath(dentry, mnt - vmiInterface->getKernelStructOffset("mount", "mnt"));
+        return createPath(dPath.dentry, dPath.mnt - kernelOffsets->mount.mnt);
+    }
+
+    std::optional<uint32_t> PathExtractor::readRenameSequence(uint64_t dtb) const
+    {
+        if (!kernelOffsets->renameLockVA)
+        {
+            return std::nullopt;
+        }
+
+        try
+        {
+            // The sequence count is the first member of the seqlock
+            const auto renameSequence = vmiInterface->read32VA(*kernelOffsets->renameLockVA, dtb);
+            // An odd sequence count indicates that a rename is in progress
+            return renameSequence % 2 == 0 ? std::make_optional(renameSequence) : std::nullopt;
+        }
+        catch (const VmiException& e)
+        {
+            logger->warning("Unable to read rename sequence.", {{"exception", e.what()}});
+            return std::nullopt;
+        }
     }
 
     std::string PathExtractor::createPath(uint64_t dentry, uint64_t mnt) const
     {
+        const auto dtb = vmiInterface->convertPidToDtb(SYSTEM_PID);
+        const auto renameSequence = readRenameSequence(dtb);
+        std::array<PathComponent, PATH_COMPONENTS_MAX> components{};
+        std::size_t depth = 0;
+        bool complete = true;
         std::string path;
+
+        // Walk from the leaf up to the root or to the first dentry with a valid cache entry, which provides the prefix
         try
         {
-            const auto name = vmiInterface->extractStringAtVA(
-                vmiInterface->read64VA(dentry + vmiInterface->getKernelStructOffset("dentry", "d_name") +
-                                           vmiInterface->getKernelStructOffset("qstr", "name"),
-                                       vmiInterface->convertPidToDtb(SYSTEM_PID)),
-                vmiInterface->convertPidToDtb(SYSTEM_PID));
-            const auto parent =
-                vmiInterface->read64VA(dentry + vmiInterface->getKernelStructOffset("dentry", "d_parent"),
-                                       vmiInterface->convertPidToDtb(SYSTEM_PID));
-            const auto mntRoot = vmiInterface->read64VA(mnt + vmiInterface->getKernelStructOffset("mount", "mnt"),
-                                                        vmiInterface->convertPidToDtb(SYSTEM_PID));
-            const auto mntMountpoint =
-                vmiInterface->read64VA(mnt + vmiInterface->getKernelStructOffset("mount", "mnt_mountpoint"),
-                                       vmiInterface->convertPidToDtb(SYSTEM_PID));
-            const auto mntParent =
-                vmiInterface->read64VA(mnt + vmiInterface->getKernelStructOffset("mount", "mnt_parent"),
-                                       vmiInterface->convertPidToDtb(SYSTEM_PID));
-
-            if (parent != dentry && dentry != mntRoot)
-            {
-                path.append(createPath(parent, mnt));
-            }
-            else if (mntParent != mnt)
+            while (true)
             {
-                path.append(createPath(mntMountpoint, mntParent));
-            }
+                if (depth == components.size())
+                {
+                    throw VmiException(fmt::format("{}: Path exceeds {} components", __func__, PATH_COMPONENTS_MAX));
+                }
 
-            if ((parent == dentry && name->at(0) == '/') || dentry == mntRoot)
-            {
-                return path;
-            }
-            if (parent == dentry)
-            {
-                return path.append(*name);
+                const auto parent = vmiInterface->read64VA(dentry + kernelOffsets->dentry.d_parent, dtb);
+                const DentryValidationToken validationToken{
+                    .nameAddress =
+                        vmiInterface->read64VA(dentry + kernelOffsets->dentry.d_name + kernelOffsets->qstr.name, dtb),
+                    .parent = parent,
+                    .inode = vmiInterface->read64VA(dentry + kernelOffsets->dentry.d_inode, dtb),
+                    .sequence = kernelOffsets->dentry.d_seq
+                                    ? vmiInterface->read32VA(dentry + *kernelOffsets->dentry.d_seq, dtb)
+                                    : 0};
+                if (renameSequence)
+                {
+                    if (auto cachedPath = pathCache->find(dentry, mnt, validationToken, *renameSequence))
+                    {
+                        path = std::move(*cachedPath);
+                        break;
+                    }
+                }
+
+                const auto mntRoot = vmiInterface->read64VA(mnt + kernelOffsets->mount.mnt, dtb);
+                components[depth++] = {.dentry = dentry,
+                                       .mnt = mnt,
+                                       .validationToken = validationToken,
+                                       .isMountRoot = dentry == mntRoot,
+                                       .isFilesystemRoot = dentry == parent,
+                                       .pathLength = 0};
+
+                if (parent != dentry && dentry != mntRoot)
+                {
+                    dentry = parent;
+                    continue;
+                }
+
+                const auto mntParent = vmiInterface->read64VA(mnt + kernelOffsets->mount.mnt_parent, dtb);
+                if (mntParent == mnt)
+                {
+                    break;
+                }
+                dentry = vmiInterface->read64VA(mnt + kernelOffsets->mount.mnt_mountpoint, dtb);
+                mnt = mntParent;
             }
-            return path.append(fmt::format("/{}", *name));
         }
         catch (const std::exception& e)
         {
+            complete = false;
             logger->warning("Unable to extract part of a path.", {{"exception", e.what()}});
         }
 
+        // Assemble the remaining path from the top down, names are only read for components below the cached prefix
+        for (auto i = depth; i-- > 0;)
+        {
+            auto& component = components[i];
+            if (!component.isMountRoot)
+            {
+                try
+                {
+                    auto name = vmiInterface->extractStringAtVA(component.validationToken.nameAddress, dtb);
+                    if (!component.isFilesystemRoot)
+                    {
+                        path.push_back('/');
+                        path.append(*name);
+                    }
+                    else if (!name->starts_with('/'))
+                    {
+                        path.append(*name);
+                    }
+                }
+                catch (const std::exception& e)
+                {
+                    complete = false;
+                    logger->warning("Unable to extract part of a path.", {{"exception", e.what()}});
+                }
+            }
+            component.pathLength = path.size();
+        }
+
+        // Only cache the components if no rename happened while they were read
+        if (complete && renameSequence && readRenameSequence(dtb) == renameSequence)
+        {
+            for (std::size_t i = 0; i < depth; i++)
+            {
+                const auto& component = components[i];
+                // An odd sequence count indicates that the dentry is being modified concurrently
+                if (component.validationToken.sequence % 2 == 0)
+                {
+                    pathCache->insert(component.dentry,
+                                      component.mnt,
+                                      component.validationToken,
+                                      *renameSequence,
+                                      path.substr(0, component.pathLength));
+                }
+            }
+        }
+
         return path;
     }
 }
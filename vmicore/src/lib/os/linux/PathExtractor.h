@@ -3,25 +3,45 @@
 
 #include "../../io/ILogging.h"
 #include "../../vmi/LibvmiInterface.h"
+#include "DentryPathCache.h"
+#include "KernelOffsets.h"
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vmicore/io/ILogger.h>
 
 namespace VmiCore::Linux
 {
+    /// Dentry and mount of a struct path. Identifies a file independently of the struct file that references it.
+    struct DPath
+    {
+        uint64_t dentry;
+        uint64_t mnt;
+    };
+
     class PathExtractor
     {
       public:
-        explicit PathExtractor(std::shared_ptr<ILibvmiInterface> vmiInterface,
-                               const std::shared_ptr<ILogging>& logging);
+        PathExtractor(std::shared_ptr<ILibvmiInterface> vmiInterface,
+                      std::shared_ptr<const KernelOffsets> kernelOffsets,
+                      std::shared_ptr<DentryPathCache> pathCache,
+                      const std::shared_ptr<ILogging>& logging);
 
         [[nodiscard]] std::string extractDPath(uint64_t path) const;
 
+        [[nodiscard]] DPath readDPath(uint64_t path) const;
+
+        [[nodiscard]] std::string extractDPath(const DPath& dPath) const;
+
       private:
         std::shared_ptr<ILibvmiInterface> vmiInterface;
+        std::shared_ptr<const KernelOffsets> kernelOffsets;
+        std::shared_ptr<DentryPathCache> pathCache;
         std::unique_ptr<ILogger> logger;
 
+        [[nodiscard]] std::optional<uint32_t> readRenameSequence(uint64_t dtb) const;
+
         [[nodiscard]] std::string createPath(uint64_t dentry, uint64_t mnt) const;
     };
 }
@@ -70,8 +70,16 @@ namespace VmiCore::Linux
         auto taskStructBase = event.getRdi();
 
         activeProcessesSupervisor->addNewProcess(taskStructBase);
-        pluginSystem->passProcessStartEventToRegisteredPlugins(
-            activeProcessesSupervisor->getProcessInformationByBase(taskStructBase));
+        // New threads resolve to the information of their thread group leader and do not start a new process
+        if (auto threadInformation = activeProcessesSupervisor->getThreadInformationByBase(taskStructBase))
+        {
+            pluginSystem->passThreadStartEventToRegisteredPlugins(*threadInformation);
+        }
+        else
+        {
+            pluginSystem->passProcessStartEventToRegisteredPlugins(
+                activeProcessesSupervisor->getProcessInformationByBase(taskStructBase));
+        }
 
         return BpResponse::Continue;
     }
@@ -80,9 +88,13 @@ namespace VmiCore::Linux
     {
         auto taskStructBase = event.getRdi();
 
-        pluginSystem->passProcessTerminationEventToRegisteredPlugins(
-            activeProcessesSupervisor->getProcessInformationByBase(taskStructBase));
-        activeProcessesSupervisor->removeActiveProcess(taskStructBase);
+        // A thread calling execve takes over the pid of its process. Any of its threads that are still registered are
+        // replaced together with the process.
+        if (auto processInformation = tryGetProcessInformationByBase(taskStructBase))
+        {
+            pluginSystem->passProcessTerminationEventToRegisteredPlugins(processInformation);
+            activeProcessesSupervisor->removeActiveProcess(taskStructBase);
+        }
         activeProcessesSupervisor->addNewProcess(taskStructBase);
         pluginSystem->passProcessStartEventToRegisteredPlugins(
             activeProcessesSupervisor->getProcessInformationByBase(taskStructBase));
@@ -94,13 +106,56 @@ namespace VmiCore::Linux
     {
         auto taskStructBase = event.getRdi();
 
-        pluginSystem->passProcessTerminationEventToRegisteredPlugins(
-            activeProcessesSupervisor->getProcessInformationByBase(taskStructBase));
+        auto processInformation = tryGetProcessInformationByBase(taskStructBase);
+        if (!processInformation)
+        {
+            logger->debug("Exit of untracked task", {{"taskStruct", fmt::format("{:#x}", taskStructBase)}});
+            return BpResponse::Continue;
+        }
+        auto threadInformation = activeProcessesSupervisor->getThreadInformationByBase(taskStructBase)
+                                     .value_or(ThreadInformation{.base = taskStructBase,
+                                                                 .threadId = processInformation->pid,
+                                                                 .pid = processInformation->pid});
         activeProcessesSupervisor->removeActiveProcess(taskStructBase);
 
+        // The process only terminates with its last thread, which is not necessarily the thread group leader
+        if (tryGetProcessInformationByPid(processInformation->pid) == processInformation)
+        {
+            pluginSystem->passThreadTerminationEventToRegisteredPlugins(threadInformation);
+        }
+        else
+        {
+            pluginSystem->passProcessTerminationEventToRegisteredPlugins(processInformation);
+        }
+
         return BpResponse::Continue;
     }
 
+    std::shared_ptr<ActiveProcessInformation>
+    SystemEventSupervisor::tryGetProcessInformationByBase(uint64_t taskStructBase) const
+    {
+        try
+        {
+            return activeProcessesSupervisor->getProcessInformationByBase(taskStructBase);
+        }
+        catch (const std::invalid_argument&)
+        {
+            return nullptr;
+        }
+    }
+
+    std::shared_ptr<ActiveProcessInformation> SystemEventSupervisor::tryGetProcessInformationByPid(pid_t pid) const
+    {
+        try
+        {
+            return activeProcessesSupervisor->getProcessInformationByPid(pid);
+        }
+        catch (const std::invalid_argument&)
+        {
+            return nullptr;
+        }
+    }
+
     void SystemEventSupervisor::teardown()
     {
         procForkConnectorEvent->remove();
@@ -57,6 +57,11 @@ namespace VmiCore::Linux
         void startProcExecConnectorMonitoring();
 
         void startProcExitConnectorMonitoring();
+
+        [[nodiscard]] std::shared_ptr<ActiveProcessInformation>
+        tryGetProcessInformationByBase(uint64_t taskStructBase) const;
+
+        [[nodiscard]] std::shared_ptr<ActiveProcessInformation> tryGetProcessInformationByPid(pid_t pid) const;
     };
 }
 
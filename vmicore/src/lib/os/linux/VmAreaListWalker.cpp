@@ -0,0 +1,32 @@
+#include "VmAreaListWalker.h"
+#include "Constants.h"
+#include <fmt/core.h>
+#include <vmicore/vmi/VmiException.h>
+
+namespace VmiCore::Linux
+{
+    VmAreaListWalker::VmAreaListWalker(std::shared_ptr<ILibvmiInterface> vmiInterface,
+                                       const KernelOffsets& kernelOffsets)
+        : vmiInterface(std::move(vmiInterface)),
+          mmapOffset(kernelOffsets.mmStruct.mmap.value_or(0)),
+          vmNextOffset(kernelOffsets.vmAreaStruct.vm_next.value_or(0)),
+          systemDtb(this->vmiInterface->convertPidToDtb(SYSTEM_PID))
+    {
+        if (!kernelOffsets.vmAreaStruct.vm_next)
+        {
+            throw VmiException(fmt::format("{}: Kernel profile lacks vm_area_struct member vm_next", __func__));
+        }
+    }
+
+    std::vector<addr_t> VmAreaListWalker::collectVmAreas(uint64_t mm) const
+    {
+        std::vector<addr_t> areas{};
+        for (auto area = vmiInterface->read64VA(mm + mmapOffset, systemDtb); area != 0;
+             area = vmiInterface->read64VA(area + vmNextOffset, systemDtb))
+        {
+            areas.push_back(area);
+        }
+
+        return areas;
+    }
+}
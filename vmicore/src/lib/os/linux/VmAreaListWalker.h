@@ -0,0 +1,29 @@
+#ifndef VMICORE_LINUX_VMAREALISTWALKER_H
+#define VMICORE_LINUX_VMAREALISTWALKER_H
+
+#include "../../vmi/LibvmiInterface.h"
+#include "IVmAreaWalker.h"
+#include "KernelOffsets.h"
+#include <memory>
+
+namespace VmiCore::Linux
+{
+    /**
+     * Follows the vm_next linked list starting at mm_struct.mmap. Used for kernels prior to 6.1.
+     */
+    class VmAreaListWalker final : public IVmAreaWalker
+    {
+      public:
+        VmAreaListWalker(std::shared_ptr<ILibvmiInterface> vmiInterface, const KernelOffsets& kernelOffsets);
+
+        [[nodiscard]] std::vector<addr_t> collectVmAreas(uint64_t mm) const override;
+
+      private:
+        std::shared_ptr<ILibvmiInterface> vmiInterface;
+        addr_t mmapOffset;
+        addr_t vmNextOffset;
+        addr_t systemDtb;
+    };
+}
+
+#endif // VMICORE_LINUX_VMAREALISTWALKER_H
@@ -59,20 +59,26 @@ namespace VmiCore::Windows
         processInformation->parentPid = kernelAccess->extractParentID(eprocessBase);
         processInformation->name = kernelAccess->extractImageFileName(eprocessBase);
         processInformation->is32BitProcess = kernelAccess->extractIsWow64Process(eprocessBase);
-        try
-        {
-            processInformation->processPath = extractProcessPath(eprocessBase);
-            processInformation->fullName = splitProcessFileNameFromPath(*processInformation->processPath);
-        }
-        catch (const std::exception& e)
-        {
-            processInformation->processPath = std::make_unique<std::string>();
-            processInformation->fullName = std::make_unique<std::string>();
-            logger->warning("Process",
-                            {{"ProcessName", processInformation->name},
-                             {"ProcessId", static_cast<uint64_t>(processInformation->pid)},
-                             {"Exception", e.what()}});
-        }
+        // The path has to be read while the guest is paused in the event handler. Plugins may access it only after the
+        // process has exited, when the section and file objects may already have been freed.
+        auto processPath = tryExtractProcessPath(eprocessBase, processInformation->pid, processInformation->name);
+        processInformation->fullName = LazyValue<std::string>(
+            [processPath]()
+            {
+                if (processPath.empty())
+                {
+                    return std::string{};
+                }
+                try
+                {
+                    return *splitProcessFileNameFromPath(processPath);
+                }
+                catch (const VmiException&)
+                {
+                    return std::string{};
+                }
+            });
+        processInformation->processPath = std::move(processPath);
         processInformation->memoryRegionExtractor = std::make_unique<VadTreeWin10>(
             kernelAccess, eprocessBase, processInformation->pid, processInformation->name, logging);
 
@@ -86,12 +92,8 @@ namespace VmiCore::Windows
 
     std::shared_ptr<ActiveProcessInformation> ActiveProcessesSupervisor::getProcessInformationByPid(pid_t pid) const
     {
-        std::shared_ptr<ActiveProcessInformation> processInformation;
-        try
-        {
-            processInformation = processInformationByPid.at(pid);
-        }
-        catch (const std::out_of_range&)
+        auto processInformation = std::atomic_load(&processTable)->findByPid(pid);
+        if (!processInformation)
         {
             throw std::invalid_argument("Unable to find process with pid " + std::to_string(pid));
         }
@@ -101,13 +103,26 @@ namespace VmiCore::Windows
     std::shared_ptr<ActiveProcessInformation>
     ActiveProcessesSupervisor::getProcessInformationByBase(uint64_t eprocessBase) const
     {
-        const auto pidIterator = pidsByEprocessBase.find(eprocessBase);
-        if (pidIterator == pidsByEprocessBase.cend())
+        auto currentProcessTable = std::atomic_load(&processTable);
+        const auto pid = currentProcessTable->findPidByBase(eprocessBase);
+        if (!pid)
         {
             throw std::invalid_argument(
                 fmt::format("{}: Process with _EPROCESS base {:#x} not in process cache.", __func__, eprocessBase));
         }
-        return getProcessInformationByPid(pidIterator->second);
+        auto processInformation = currentProcessTable->findByPid(*pid);
+        if (!processInformation)
+        {
+            throw std::invalid_argument("Unable to find process with pid " + std::to_string(*pid));
+        }
+        return processInformation;
+    }
+
+    std::optional<ThreadInformation>
+    ActiveProcessesSupervisor::getThreadInformationByBase([[maybe_unused]] uint64_t eprocessBase) const
+    {
+        // Threads are not tracked, every _EPROCESS base belongs to a process
+        return std::nullopt;
     }
 
     void ActiveProcessesSupervisor::addNewProcess(uint64_t eprocessBase)
@@ -116,12 +131,13 @@ namespace VmiCore::Windows
         std::string parentPid("unknownParentPid");
         std::string parentName("unknownParentName");
         std::string parentDtb("unknownParentDtb");
-        auto parentProcessInformation = processInformationByPid.find(processInformation->parentPid);
-        if (parentProcessInformation != processInformationByPid.end())
+        std::scoped_lock processTableUpdateLock(processTableUpdateMutex);
+        auto currentProcessTable = std::atomic_load(&processTable);
+        if (auto parentProcessInformation = currentProcessTable->findByPid(processInformation->parentPid))
         {
-            parentPid = std::to_string(parentProcessInformation->second->pid);
-            parentName = parentProcessInformation->second->name;
-            parentDtb = fmt::format("{:#x}", parentProcessInformation->second->processDtb);
+            parentPid = std::to_string(parentProcessInformation->pid);
+            parentName = parentProcessInformation->name;
+            parentDtb = fmt::format("{:#x}", parentProcessInformation->processDtb);
         }
         eventStream->sendProcessEvent(::grpc::ProcessState::Started,
                                       processInformation->name,
@@ -135,87 +151,79 @@ namespace VmiCore::Windows
                       {"ParentProcessName", parentName},
                       {"ParentProcessId", parentPid},
                       {"ParentProcessDtb", parentDtb}});
-        processInformationByPid[processInformation->pid] = processInformation;
-        pidsByEprocessBase[processInformation->base] = processInformation->pid;
+
+        // Processes that already exited but are still referenced may be encountered while walking the process list
+        // during initialization. Since their termination notification has already passed, they are never considered
+        // active. Every other process stays active until its termination notification arrives.
+        std::atomic_store(&processTable,
+                          currentProcessTable->withProcess(processInformation, isProcessActive(*processInformation)));
     }
 
-    bool ActiveProcessesSupervisor::isProcessActive(uint64_t eprocessBase) const
+    bool ActiveProcessesSupervisor::isProcessActive(const ActiveProcessInformation& processInformation) const
     {
-        auto exitStatus = kernelAccess->extractExitStatus(eprocessBase);
+        auto exitStatus = kernelAccess->extractExitStatus(processInformation.base);
         if (exitStatus == statusPending)
         {
             return true;
         }
         logger->debug("Encountered a process that has got an exit status other than 'status pending'",
-                      {{"_EPROCESS_base", fmt::format("{:#x}", eprocessBase)},
-                       {"ProcessId", static_cast<uint64_t>(kernelAccess->extractPID(eprocessBase))},
+                      {{"_EPROCESS_base", fmt::format("{:#x}", processInformation.base)},
+                       {"ProcessId", static_cast<uint64_t>(processInformation.pid)},
                        {"ExitStatus", static_cast<uint64_t>(exitStatus)}});
         return false;
     }
 
     void ActiveProcessesSupervisor::removeActiveProcess(uint64_t eprocessBase)
     {
-        auto eprocessBaseIterator = pidsByEprocessBase.find(eprocessBase);
-        if (eprocessBaseIterator != pidsByEprocessBase.end())
+        std::scoped_lock processTableUpdateLock(processTableUpdateMutex);
+        auto currentProcessTable = std::atomic_load(&processTable);
+        auto pid = currentProcessTable->findPidByBase(eprocessBase);
+        if (!pid)
+        {
+            logger->warning("Process does not seem to be stored as an active process",
+                            {{"_EPROCESS_base", fmt::format("{:#x}", eprocessBase)}});
+            return;
+        }
+
+        if (auto processInformation = currentProcessTable->findByPid(*pid))
         {
-            auto processInformationIterator = processInformationByPid.find(eprocessBaseIterator->second);
-            if (processInformationIterator == processInformationByPid.end())
+            std::string parentPid("unknownParentPid");
+            std::string parentName("unknownParentName");
+            std::string parentDtb("unknownParentDtb");
+            if (auto parentProcessInformation = currentProcessTable->findByPid(processInformation->parentPid))
             {
-                logger->warning("Process information not found for process",
-                                {{"_EPROCESS_base", fmt::format("{:#x}", eprocessBase)},
-                                 {"ProcessId", static_cast<uint64_t>(eprocessBaseIterator->second)}});
+                parentPid = std::to_string(parentProcessInformation->pid);
+                parentName = parentProcessInformation->name;
+                parentDtb = fmt::format("{:#x}", parentProcessInformation->processDtb);
             }
-            else
-            {
-                std::string parentPid("unknownParentPid");
-                std::string parentName("unknownParentName");
-                std::string parentDtb("unknownParentDtb");
-                auto parentProcessInformation =
-                    processInformationByPid.find(processInformationIterator->second->parentPid);
-                if (parentProcessInformation != processInformationByPid.end())
-                {
-                    parentPid = std::to_string(parentProcessInformation->second->pid);
-                    parentName = parentProcessInformation->second->name;
-                    parentDtb = fmt::format("{:#x}", parentProcessInformation->second->processDtb);
-                }
 
-                eventStream->sendProcessEvent(::grpc::ProcessState::Terminated,
-                                              processInformationIterator->second->name,
-                                              static_cast<uint32_t>(processInformationIterator->second->pid),
-                                              fmt::format("{:#x}", processInformationIterator->second->processDtb));
-                logger->info(
-                    "Remove process from actives processes",
-                    {{"ProcessName", processInformationIterator->second->name},
-                     {"ProcessId", static_cast<uint64_t>(processInformationIterator->second->pid)},
-                     {"ProcessDtb", fmt::format("{:#x}", processInformationIterator->second->processDtb)},
-                     {"ProcessUserDtb", fmt::format("{:#x}", processInformationIterator->second->processUserDtb)},
-                     {"ParentProcessName", parentName},
-                     {"ParentProcessId", parentPid},
-                     {"ParentProcessCr3", parentDtb}});
-
-                processInformationByPid.erase(processInformationIterator);
-            }
-            pidsByEprocessBase.erase(eprocessBaseIterator);
+            eventStream->sendProcessEvent(::grpc::ProcessState::Terminated,
+                                          processInformation->name,
+                                          static_cast<uint32_t>(processInformation->pid),
+                                          fmt::format("{:#x}", processInformation->processDtb));
+            logger->info("Remove process from actives processes",
+                         {{"ProcessName", processInformation->name},
+                          {"ProcessId", static_cast<uint64_t>(processInformation->pid)},
+                          {"ProcessDtb", fmt::format("{:#x}", processInformation->processDtb)},
+                          {"ProcessUserDtb", fmt::format("{:#x}", processInformation->processUserDtb)},
+                          {"ParentProcessName", parentName},
+                          {"ParentProcessId", parentPid},
+                          {"ParentProcessCr3", parentDtb}});
         }
         else
         {
-            logger->warning("Process does not seem to be stored as an active process",
-                            {{"_EPROCESS_base", fmt::format("{:#x}", eprocessBase)}});
+            logger->warning("Process information not found for process",
+                            {{"_EPROCESS_base", fmt::format("{:#x}", eprocessBase)},
+                             {"ProcessId", static_cast<uint64_t>(*pid)}});
         }
+
+        std::atomic_store(&processTable, currentProcessTable->withoutProcess(eprocessBase));
     }
 
-    std::unique_ptr<std::vector<std::shared_ptr<const ActiveProcessInformation>>>
+    std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>>
     ActiveProcessesSupervisor::getActiveProcesses() const
     {
-        auto runningProcesses = std::make_unique<std::vector<std::shared_ptr<const ActiveProcessInformation>>>();
-        for (const auto& element : processInformationByPid)
-        {
-            if (isProcessActive(element.second->base))
-            {
-                runningProcesses->push_back(element.second);
-            }
-        }
-        return runningProcesses;
+        return std::atomic_load(&processTable)->getActiveProcesses();
     }
 
     std::unique_ptr<std::string> ActiveProcessesSupervisor::extractProcessPath(uint64_t eprocessBase) const
@@ -234,6 +242,22 @@ namespace VmiCore::Windows
         return processPath;
     }
 
+    std::string
+    ActiveProcessesSupervisor::tryExtractProcessPath(uint64_t eprocessBase, pid_t pid, const std::string& name) const
+    {
+        try
+        {
+            return *extractProcessPath(eprocessBase);
+        }
+        catch (const std::exception& e)
+        {
+            logger->warning(
+                "Process",
+                {{"ProcessName", name}, {"ProcessId", static_cast<uint64_t>(pid)}, {"Exception", e.what()}});
+        }
+        return {};
+    }
+
     std::unique_ptr<std::string> ActiveProcessesSupervisor::splitProcessFileNameFromPath(const std::string& path)
     {
         auto substringStartIterator =
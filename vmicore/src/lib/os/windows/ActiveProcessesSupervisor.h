@@ -5,10 +5,12 @@
 #include "../../io/ILogging.h"
 #include "../../vmi/LibvmiInterface.h"
 #include "../IActiveProcessesSupervisor.h"
+#include "../ProcessTable.h"
 #include "Constants.h"
 #include "VadTreeWin10.h"
-#include <map>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <vmicore/io/ILogger.h>
 
 namespace VmiCore::Windows
@@ -30,28 +32,35 @@ namespace VmiCore::Windows
         [[nodiscard]] std::shared_ptr<ActiveProcessInformation>
         getProcessInformationByBase(uint64_t eprocessBase) const override;
 
+        [[nodiscard]] std::optional<ThreadInformation> getThreadInformationByBase(uint64_t eprocessBase) const override;
+
         void addNewProcess(uint64_t eprocessBase) override;
 
         void removeActiveProcess(uint64_t eprocessBase) override;
 
-        [[nodiscard]] std::unique_ptr<std::vector<std::shared_ptr<const ActiveProcessInformation>>>
+        [[nodiscard]] std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>>
         getActiveProcesses() const override;
 
       private:
         std::shared_ptr<ILibvmiInterface> vmiInterface;
         std::shared_ptr<IKernelAccess> kernelAccess;
-        std::map<pid_t, std::shared_ptr<ActiveProcessInformation>> processInformationByPid;
-        std::map<uint64_t, pid_t> pidsByEprocessBase;
+        // Published and read with std::atomic_store/std::atomic_load, std::atomic<std::shared_ptr> is not supported by
+        // all standard libraries yet
+        std::shared_ptr<const ProcessTable> processTable = std::make_shared<const ProcessTable>();
+        std::mutex processTableUpdateMutex;
         std::unique_ptr<ILogger> logger;
         std::shared_ptr<ILogging> logging;
         std::shared_ptr<IEventStream> eventStream;
 
-        [[nodiscard]] bool isProcessActive(uint64_t eprocessBase) const;
+        [[nodiscard]] bool isProcessActive(const ActiveProcessInformation& processInformation) const;
 
         [[nodiscard]] std::unique_ptr<ActiveProcessInformation> extractProcessInformation(uint64_t eprocessBase) const;
 
         [[nodiscard]] std::unique_ptr<std::string> extractProcessPath(uint64_t eprocessBase) const;
 
+        [[nodiscard]] std::string
+        tryExtractProcessPath(uint64_t eprocessBase, pid_t pid, const std::string& name) const;
+
         [[nodiscard]] static std::unique_ptr<std::string> splitProcessFileNameFromPath(const std::string& path);
     };
 }
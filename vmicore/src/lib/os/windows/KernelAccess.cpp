@@ -185,23 +185,19 @@ namespace VmiCore::Windows
 
     uint8_t KernelAccess::extractProtectionFlagValue(addr_t vadShortBaseVA) const
     {
-        auto flagsSize = vmiInterface->getStructSizeFromJson(KernelStructOffsets::mmvad_flags::structName);
         // As of now, there are 32 Protectionvalues
         assert((kernelOffsets.mmvadFlags.protection.endBit - kernelOffsets.mmvadFlags.protection.startBit) < 6);
         return static_cast<uint8_t>(extractFlagValue(getMmVadShortFlagsAddr(vadShortBaseVA),
-                                                     flagsSize,
-                                                     kernelOffsets.mmvadFlags.protection.startBit,
-                                                     kernelOffsets.mmvadFlags.protection.endBit));
+                                                     kernelOffsets.mmvadFlags.size,
+                                                     kernelOffsets.mmvadFlags.protection));
     }
 
     bool KernelAccess::extractIsPrivateMemory(addr_t vadShortBaseVA) const
     {
-        auto flagsSize = vmiInterface->getStructSizeFromJson(KernelStructOffsets::mmvad_flags::structName);
         assert((kernelOffsets.mmvadFlags.privateMemory.endBit - kernelOffsets.mmvadFlags.privateMemory.startBit) == 1);
         return static_cast<bool>(extractFlagValue(getMmVadShortFlagsAddr(vadShortBaseVA),
-                                                  flagsSize,
-                                                  kernelOffsets.mmvadFlags.privateMemory.startBit,
-                                                  kernelOffsets.mmvadFlags.privateMemory.endBit));
+                                                  kernelOffsets.mmvadFlags.size,
+                                                  kernelOffsets.mmvadFlags.privateMemory));
     }
 
     addr_t KernelAccess::getMmSectionFlagsAddr(addr_t controlAreaBaseVA) const
@@ -211,33 +207,27 @@ namespace VmiCore::Windows
 
     bool KernelAccess::extractIsBeingDeleted(addr_t controlAreaBaseVA) const
     {
-        auto flagsSize = vmiInterface->getStructSizeFromJson(KernelStructOffsets::mmsection_flags::structName);
         assert((kernelOffsets.mmsectionFlags.beingDeleted.endBit -
                 kernelOffsets.mmsectionFlags.beingDeleted.startBit) == 1);
         return static_cast<bool>(extractFlagValue(getMmSectionFlagsAddr(controlAreaBaseVA),
-                                                  flagsSize,
-                                                  kernelOffsets.mmsectionFlags.beingDeleted.startBit,
-                                                  kernelOffsets.mmsectionFlags.beingDeleted.endBit));
+                                                  kernelOffsets.mmsectionFlags.size,
+                                                  kernelOffsets.mmsectionFlags.beingDeleted));
     }
 
     bool KernelAccess::extractIsImage(addr_t controlAreaBaseVA) const
     {
-        auto flagsSize = vmiInterface->getStructSizeFromJson(KernelStructOffsets::mmsection_flags::structName);
         assert((kernelOffsets.mmsectionFlags.image.endBit - kernelOffsets.mmsectionFlags.image.startBit) == 1);
         return static_cast<bool>(extractFlagValue(getMmSectionFlagsAddr(controlAreaBaseVA),
-                                                  flagsSize,
-                                                  kernelOffsets.mmsectionFlags.image.startBit,
-                                                  kernelOffsets.mmsectionFlags.image.endBit));
+                                                  kernelOffsets.mmsectionFlags.size,
+                                                  kernelOffsets.mmsectionFlags.image));
     }
 
     bool KernelAccess::extractIsFile(addr_t controlAreaBaseVA) const
     {
-        auto flagsSize = vmiInterface->getStructSizeFromJson(KernelStructOffsets::mmsection_flags::structName);
         assert((kernelOffsets.mmsectionFlags.file.endBit - kernelOffsets.mmsectionFlags.file.startBit) == 1);
         return static_cast<bool>(extractFlagValue(getMmSectionFlagsAddr(controlAreaBaseVA),
-                                                  flagsSize,
-                                                  kernelOffsets.mmsectionFlags.file.startBit,
-                                                  kernelOffsets.mmsectionFlags.file.endBit));
+                                                  kernelOffsets.mmsectionFlags.size,
+                                                  kernelOffsets.mmsectionFlags.file));
     }
 
     addr_t KernelAccess::getVadNodeRightChildOffset() const
@@ -252,7 +242,9 @@ namespace VmiCore::Windows
                kernelOffsets.rtlBalancedNode.Left;
     }
 
-    uint64_t KernelAccess::extractFlagValue(addr_t flagBaseVA, size_t size, size_t startBit, size_t endBit) const
+    uint64_t KernelAccess::extractFlagValue(addr_t flagBaseVA,
+                                            size_t size,
+                                            const KernelStructOffsets::_flag& flag) const
     {
         expectSaneKernelAddress(flagBaseVA, static_cast<const char*>(__func__));
         uint64_t flagValue = 0;
@@ -269,7 +261,7 @@ namespace VmiCore::Windows
                     "{}: {} is unknown flag struct size", KernelStructOffsets::mmvad_flags::structName, size));
         }
 
-        return getFlagValue(flagValue, startBit, endBit);
+        return flag.extract(flagValue);
     }
 
     bool KernelAccess::extractIsWow64Process(uint64_t eprocessBase) const
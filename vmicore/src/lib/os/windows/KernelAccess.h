@@ -156,18 +156,8 @@ namespace VmiCore::Windows
 
         [[nodiscard]] addr_t getVadNodeRightChildOffset() const;
 
-        [[nodiscard]] uint64_t extractFlagValue(addr_t flagBaseVA, size_t size, size_t startBit, size_t endBit) const;
-
-        template <typename T> T getFlagValue(T flags, size_t startBit, size_t endBit) const
-        {
-            size_t flagLength = endBit - startBit;
-            // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
-            T flagValueMSB = flags << (sizeof(flags) * 8 - (endBit));
-            // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
-            T flagValueLSB = flagValueMSB >> (sizeof(flags) * 8 - (flagLength));
-
-            return flagValueLSB;
-        }
+        [[nodiscard]] uint64_t
+        extractFlagValue(addr_t flagBaseVA, size_t size, const KernelStructOffsets::_flag& flag) const;
 
         static void expectSaneKernelAddress(addr_t address, const char* caller);
     };
@@ -14,11 +14,14 @@ namespace VmiCore::Windows
         }
 
         KernelOffsets kernelOffsets{
-            .mmvadFlags = {.protection{vmiInterface->getBitfieldOffsetAndSizeFromJson(
+            .mmvadFlags = {.size = vmiInterface->getStructSizeFromJson(KernelStructOffsets::mmvad_flags::structName),
+                           .protection{vmiInterface->getBitfieldOffsetAndSizeFromJson(
                                KernelStructOffsets::mmvad_flags::structName, "Protection")},
                            .privateMemory{vmiInterface->getBitfieldOffsetAndSizeFromJson(
                                KernelStructOffsets::mmvad_flags::structName, "PrivateMemory")}},
-            .mmsectionFlags = {.beingDeleted{vmiInterface->getBitfieldOffsetAndSizeFromJson(
+            .mmsectionFlags = {.size = vmiInterface->getStructSizeFromJson(
+                                   KernelStructOffsets::mmsection_flags::structName),
+                               .beingDeleted{vmiInterface->getBitfieldOffsetAndSizeFromJson(
                                    KernelStructOffsets::mmsection_flags::structName, "BeingDeleted")},
                                .image{vmiInterface->getBitfieldOffsetAndSizeFromJson(
                                    KernelStructOffsets::mmsectionFlags::structName, "Image")},
@@ -81,16 +81,27 @@ namespace VmiCore::Windows
             _flag() = default;
 
             _flag(const std::tuple<addr_t, size_t, size_t>& flagInfo) // NOLINT(google-explicit-constructor)
-                : offset(std::get<0>(flagInfo)), startBit(std::get<1>(flagInfo)), endBit(std::get<2>(flagInfo)) {};
+                : offset(std::get<0>(flagInfo)),
+                  startBit(std::get<1>(flagInfo)),
+                  endBit(std::get<2>(flagInfo)),
+                  mask(endBit - startBit >= 64 ? ~0ULL : (1ULL << (endBit - startBit)) - 1) {};
+
+            /// Decodes the flag from the raw value of its containing bitfield.
+            [[nodiscard]] constexpr uint64_t extract(uint64_t flags) const
+            {
+                return (flags >> startBit) & mask;
+            }
 
             addr_t offset;
             size_t startBit;
             size_t endBit;
+            uint64_t mask;
         } __attribute__((aligned(32)));
 
         using mmvadFlags = struct mmvad_flags
         {
             constexpr static const char* structName = "_MMVAD_FLAGS";
+            size_t size;
             _flag protection;
             _flag privateMemory;
         } __attribute__((aligned(128)));
@@ -98,6 +109,7 @@ namespace VmiCore::Windows
         using mmsectionFlags = struct mmsection_flags
         {
             constexpr static const char* structName = "_MMSECTION_FLAGS";
+            size_t size;
             _flag beingDeleted;
             _flag image;
             _flag file;
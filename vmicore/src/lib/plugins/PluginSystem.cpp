@@ -1,5 +1,6 @@
 #include "PluginSystem.h"
 #include "../vmi/MemoryMapping.h"
+#include "../vmi/MemorySnapshot.h"
 #include "PluginException.h"
 #include <bit>
 #include <cstdint>
@@ -7,12 +8,20 @@
 #include <fmt/core.h>
 #include <utility>
 #include <vmicore/filename.h>
+#include <vmicore/os/PagingDefinitions.h>
 
 namespace VmiCore
 {
     namespace
     {
         bool isInstanciated = false;
+        // Maximum number of pending events per plugin before the delivering vcpu is blocked
+        constexpr std::size_t pluginEventQueueCapacity = 1024;
+
+        std::size_t getNumberOfPages(const MemoryRegion& memoryRegion)
+        {
+            return (memoryRegion.size + PagingDefinitions::pageOffsetMask) >> PagingDefinitions::numberOfPageIndexBits;
+        }
     }
 
     PluginSystem::PluginSystem(std::shared_ptr<IConfigParser> configInterface,
@@ -27,6 +36,7 @@ namespace VmiCore
           activeProcessesSupervisor(std::move(activeProcessesSupervisor)),
           interruptEventSupervisor(std::move(interruptEventSupervisor)),
           fileTransport(std::move(pluginLogging)),
+          snapshotArenaPool(std::make_shared<SnapshotArenaPool>(this->configInterface->getSnapshotMemoryLimit())),
           loggingLib(std::move(loggingLib)),
           logger(this->loggingLib->newNamedLogger(FILENAME_STEM)),
           eventStream(std::move(eventStream))
@@ -40,6 +50,7 @@ namespace VmiCore
 
     PluginSystem::~PluginSystem()
     {
+        stopPluginEventDispatchers();
         isInstanciated = false;
     }
 
@@ -50,18 +61,127 @@ namespace VmiCore
             loggingLib, vmiInterface, vmiInterface->mmapGuest(baseVA, dtb, numberOfPages));
     }
 
+    std::unique_ptr<IMemorySnapshot>
+    PluginSystem::snapshotProcessMemory(const ActiveProcessInformation& processInformation,
+                                        const std::function<bool(const MemoryRegion&)>& filter) const
+    {
+        auto memoryRegions = processInformation.memoryRegionExtractor->extractAllMemoryRegions();
+        std::erase_if(*memoryRegions, [&filter](const MemoryRegion& memoryRegion) { return !filter(memoryRegion); });
+
+        // The region sizes bound the snapshot size, checking them first avoids mapping regions only to reject them
+        std::size_t maximumSnapshotSize = 0;
+        for (const auto& memoryRegion : *memoryRegions)
+        {
+            maximumSnapshotSize += getNumberOfPages(memoryRegion) << PagingDefinitions::numberOfPageIndexBits;
+        }
+        if (SnapshotArenaPool::getArenaSize(maximumSnapshotSize) > snapshotArenaPool->getMemoryLimit())
+        {
+            throw std::length_error(fmt::format("Memory regions of process {} span {} bytes, which exceeds the "
+                                                "snapshot memory limit of {} bytes",
+                                                processInformation.pid,
+                                                maximumSnapshotSize,
+                                                snapshotArenaPool->getMemoryLimit()));
+        }
+
+        std::vector<std::pair<MemoryRegion, std::unique_ptr<IMemoryMapping>>> memoryRegionMappings;
+        memoryRegionMappings.reserve(memoryRegions->size());
+
+        for (auto& memoryRegion : *memoryRegions)
+        {
+            try
+            {
+                auto memoryMapping = mapProcessMemoryRegion(
+                    memoryRegion.base, processInformation.processUserDtb, getNumberOfPages(memoryRegion));
+                if (!memoryMapping->getMappedRegions().empty())
+                {
+                    memoryRegionMappings.emplace_back(std::move(memoryRegion), std::move(memoryMapping));
+                }
+            }
+            catch (const std::exception& e)
+            {
+                logger->warning("Unable to map memory region for snapshot",
+                                {{"pid", processInformation.pid},
+                                 {"baseVA", fmt::format("{:x}", memoryRegion.base)},
+                                 {"exception", e.what()}});
+            }
+        }
+
+        return MemorySnapshot::create(*snapshotArenaPool, std::move(memoryRegionMappings));
+    }
+
     void PluginSystem::registerProcessStartEvent(
         const std::function<void(std::shared_ptr<const ActiveProcessInformation>)>& startCallback)
     {
         registeredProcessStartCallbacks.push_back(startCallback);
     }
 
+    void PluginSystem::registerProcessStartEvent(
+        const std::function<void(std::shared_ptr<const ActiveProcessInformation>)>& startCallback,
+        Plugin::EventDelivery delivery)
+    {
+        registeredProcessStartCallbacks.push_back(
+            delivery == Plugin::EventDelivery::Asynchronous ? createAsyncCallback(startCallback) : startCallback);
+    }
+
     void PluginSystem::registerProcessTerminationEvent(
         const std::function<void(std::shared_ptr<const ActiveProcessInformation>)>& terminationCallback)
     {
         registeredProcessTerminationCallbacks.push_back(terminationCallback);
     }
 
+    void PluginSystem::registerProcessTerminationEvent(
+        const std::function<void(std::shared_ptr<const ActiveProcessInformation>)>& terminationCallback,
+        Plugin::EventDelivery delivery)
+    {
+        registeredProcessTerminationCallbacks.push_back(delivery == Plugin::EventDelivery::Asynchronous
+                                                            ? createAsyncCallback(terminationCallback)
+                                                            : terminationCallback);
+    }
+
+    void PluginSystem::registerThreadStartEvent(const std::function<void(const ThreadInformation&)>& startCallback)
+    {
+        registeredThreadStartCallbacks.push_back(startCallback);
+    }
+
+    void PluginSystem::registerThreadTerminationEvent(
+        const std::function<void(const ThreadInformation&)>& terminationCallback)
+    {
+        registeredThreadTerminationCallbacks.push_back(terminationCallback);
+    }
+
+    std::function<void(std::shared_ptr<const ActiveProcessInformation>)> PluginSystem::createAsyncCallback(
+        const std::function<void(std::shared_ptr<const ActiveProcessInformation>)>& callback)
+    {
+        // Registrations outside of plugin initialization cannot be attributed to a plugin and would share a worker
+        if (initializingPluginName.empty())
+        {
+            throw std::runtime_error(
+                fmt::format("{}: Asynchronous delivery is only available during plugin initialization", __func__));
+        }
+
+        // All asynchronous events of a plugin share a single worker, which preserves their order for every process
+        auto& dispatcher = pluginEventDispatchers[initializingPluginName];
+        if (!dispatcher)
+        {
+            dispatcher = std::make_shared<ProcessEventDispatcher>(loggingLib, pluginEventQueueCapacity);
+        }
+
+        return [dispatcher, callback](std::shared_ptr<const ActiveProcessInformation> processInformation)
+        {
+            // Events racing with plugin unloading are dropped, the plugin is not interested in them anymore
+            dispatcher->tryPost([callback, processInformation = std::move(processInformation)]()
+                                { callback(processInformation); });
+        };
+    }
+
+    void PluginSystem::stopPluginEventDispatchers()
+    {
+        for (auto& [name, dispatcher] : pluginEventDispatchers)
+        {
+            dispatcher->stop();
+        }
+    }
+
     std::shared_ptr<IBreakpoint>
     PluginSystem::createBreakpoint(uint64_t targetVA,
                                    const ActiveProcessInformation& processInformation,
@@ -102,6 +222,34 @@ namespace VmiCore
         }
     }
 
+    void PluginSystem::appendToFile(const std::string& filename, std::span<const uint8_t> data) const
+    {
+        try
+        {
+            fileTransport->appendToFile(filename, data);
+        }
+        catch (const std::exception& e)
+        {
+            logger->error("Failed to append to file", {{"filename", filename}, {"exception", e.what()}});
+            eventStream->sendErrorEvent(e.what());
+        }
+    }
+
+    void PluginSystem::writeSegmentsToFile(const std::string& filename,
+                                           std::span<const FileSegment> segments,
+                                           std::size_t fileSize) const
+    {
+        try
+        {
+            fileTransport->saveSegmentsToFile(filename, segments, fileSize);
+        }
+        catch (const std::exception& e)
+        {
+            logger->error("Failed to write segments to file", {{"filename", filename}, {"exception", e.what()}});
+            eventStream->sendErrorEvent(e.what());
+        }
+    }
+
     void PluginSystem::sendErrorEvent(std::string_view message) const
     {
         eventStream->sendErrorEvent(message);
@@ -122,7 +270,7 @@ namespace VmiCore
         return std::make_unique<std::string>(configInterface->getResultsDirectory());
     }
 
-    std::unique_ptr<std::vector<std::shared_ptr<const ActiveProcessInformation>>>
+    std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>>
     PluginSystem::getRunningProcesses() const
     {
         return activeProcessesSupervisor->getActiveProcesses();
@@ -169,7 +317,26 @@ namespace VmiCore
             throw PluginException(pluginName, fmt::format("Unable to retrieve init function: {}", dlErrorMessage));
         }
 
-        auto plugin = pluginInitFunction(dynamic_cast<Plugin::PluginInterface*>(this), std::move(config), args);
+        runPluginInit(pluginName, pluginInitFunction, std::move(config), args);
+    }
+
+    void PluginSystem::runPluginInit(const std::string& pluginName,
+                                     decltype(Plugin::vmicore_plugin_init)* pluginInitFunction,
+                                     std::shared_ptr<Plugin::IPluginConfig> config,
+                                     const std::vector<std::string>& args)
+    {
+        initializingPluginName = pluginName;
+        std::unique_ptr<Plugin::IPlugin> plugin;
+        try
+        {
+            plugin = pluginInitFunction(dynamic_cast<Plugin::PluginInterface*>(this), std::move(config), args);
+        }
+        catch (...)
+        {
+            initializingPluginName.clear();
+            throw;
+        }
+        initializingPluginName.clear();
 
         plugins.emplace_back(pluginName, std::move(plugin));
     }
@@ -201,10 +368,28 @@ namespace VmiCore
         }
     }
 
+    void PluginSystem::passThreadStartEventToRegisteredPlugins(const ThreadInformation& threadInformation)
+    {
+        for (const auto& threadStartCallback : registeredThreadStartCallbacks)
+        {
+            threadStartCallback(threadInformation);
+        }
+    }
+
+    void PluginSystem::passThreadTerminationEventToRegisteredPlugins(const ThreadInformation& threadInformation)
+    {
+        for (const auto& threadTerminationCallback : registeredThreadTerminationCallbacks)
+        {
+            threadTerminationCallback(threadInformation);
+        }
+    }
+
     void PluginSystem::unloadPlugins()
     {
         vmiInterface->flushV2PCache(LibvmiInterface::flushAllPTs);
         vmiInterface->flushPageCache();
+        // Deliver all pending events before the plugins are told to shut down
+        stopPluginEventDispatchers();
 
         for (auto& [name, plugin] : plugins)
         {
@@ -221,6 +406,9 @@ namespace VmiCore
 
         registeredProcessStartCallbacks.clear();
         registeredProcessTerminationCallbacks.clear();
+        registeredThreadStartCallbacks.clear();
+        registeredThreadTerminationCallbacks.clear();
+        pluginEventDispatchers.clear();
         plugins.clear();
     }
 }
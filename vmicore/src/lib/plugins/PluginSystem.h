@@ -6,8 +6,10 @@
 #include "../io/ILogging.h"
 #include "../io/file/LegacyLogging.h"
 #include "../os/IActiveProcessesSupervisor.h"
+#include "../os/ProcessEventDispatcher.h"
 #include "../vmi/InterruptEventSupervisor.h"
 #include "../vmi/LibvmiInterface.h"
+#include "../vmi/SnapshotArenaPool.h"
 #include <cstdint>
 #include <functional>
 #include <map>
@@ -33,6 +35,10 @@ namespace VmiCore
         virtual void passProcessTerminationEventToRegisteredPlugins(
             std::shared_ptr<const ActiveProcessInformation> processInformation) = 0;
 
+        virtual void passThreadStartEventToRegisteredPlugins(const ThreadInformation& threadInformation) = 0;
+
+        virtual void passThreadTerminationEventToRegisteredPlugins(const ThreadInformation& threadInformation) = 0;
+
         virtual void unloadPlugins() = 0;
 
       protected:
@@ -60,37 +66,74 @@ namespace VmiCore
         void passProcessTerminationEventToRegisteredPlugins(
             std::shared_ptr<const ActiveProcessInformation> processInformation) override;
 
+        void passThreadStartEventToRegisteredPlugins(const ThreadInformation& threadInformation) override;
+
+        void passThreadTerminationEventToRegisteredPlugins(const ThreadInformation& threadInformation) override;
+
         void unloadPlugins() override;
 
+        /**
+         * Runs the init function of an already loaded plugin. Asynchronous event subscriptions made by the init
+         * function are assigned to this plugin.
+         */
+        void runPluginInit(const std::string& pluginName,
+                           decltype(Plugin::vmicore_plugin_init)* pluginInitFunction,
+                           std::shared_ptr<Plugin::IPluginConfig> config,
+                           const std::vector<std::string>& args);
+
       private:
         std::shared_ptr<IConfigParser> configInterface;
         std::shared_ptr<ILibvmiInterface> vmiInterface;
         std::shared_ptr<IActiveProcessesSupervisor> activeProcessesSupervisor;
         std::shared_ptr<IInterruptEventSupervisor> interruptEventSupervisor;
         std::shared_ptr<IFileTransport> fileTransport;
+        std::shared_ptr<SnapshotArenaPool> snapshotArenaPool;
         std::vector<std::function<void(std::shared_ptr<const ActiveProcessInformation>)>>
             registeredProcessStartCallbacks;
         std::vector<std::function<void(std::shared_ptr<const ActiveProcessInformation>)>>
             registeredProcessTerminationCallbacks;
+        std::vector<std::function<void(const ThreadInformation&)>> registeredThreadStartCallbacks;
+        std::vector<std::function<void(const ThreadInformation&)>> registeredThreadTerminationCallbacks;
         std::shared_ptr<ILogging> loggingLib;
         std::unique_ptr<ILogger> logger;
         std::shared_ptr<IEventStream> eventStream;
         std::vector<std::pair<std::string, std::unique_ptr<Plugin::IPlugin>>> plugins;
+        // Name of the plugin whose init function is currently running, used to assign asynchronous event workers
+        std::string initializingPluginName;
+        // Declared after the plugins so that pending events are delivered before any plugin is destroyed
+        std::map<std::string, std::shared_ptr<ProcessEventDispatcher>, std::less<>> pluginEventDispatchers;
 
         [[nodiscard]] std::unique_ptr<std::string> getResultsDir() const override;
 
         [[nodiscard]] std::unique_ptr<IMemoryMapping>
         mapProcessMemoryRegion(addr_t baseVA, addr_t dtb, std::size_t numberOfPages) const override;
 
-        [[nodiscard]] std::unique_ptr<std::vector<std::shared_ptr<const ActiveProcessInformation>>>
+        [[nodiscard]] std::unique_ptr<IMemorySnapshot>
+        snapshotProcessMemory(const ActiveProcessInformation& processInformation,
+                              const std::function<bool(const MemoryRegion&)>& filter) const override;
+
+        [[nodiscard]] std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>>
         getRunningProcesses() const override;
 
         void registerProcessStartEvent(
             const std::function<void(std::shared_ptr<const ActiveProcessInformation>)>& startCallback) override;
 
+        void registerProcessStartEvent(
+            const std::function<void(std::shared_ptr<const ActiveProcessInformation>)>& startCallback,
+            Plugin::EventDelivery delivery) override;
+
         void registerProcessTerminationEvent(
             const std::function<void(std::shared_ptr<const ActiveProcessInformation>)>& terminationCallback) override;
 
+        void registerProcessTerminationEvent(
+            const std::function<void(std::shared_ptr<const ActiveProcessInformation>)>& terminationCallback,
+            Plugin::EventDelivery delivery) override;
+
+        void registerThreadStartEvent(const std::function<void(const ThreadInformation&)>& startCallback) override;
+
+        void registerThreadTerminationEvent(
+            const std::function<void(const ThreadInformation&)>& terminationCallback) override;
+
         [[nodiscard]] std::shared_ptr<IBreakpoint>
         createBreakpoint(uint64_t targetVA,
                          const ActiveProcessInformation& processInformation,
@@ -102,6 +145,12 @@ namespace VmiCore
 
         void writeToFile(const std::string& filename, const std::vector<uint8_t>& data) const override;
 
+        void appendToFile(const std::string& filename, std::span<const uint8_t> data) const override;
+
+        void writeSegmentsToFile(const std::string& filename,
+                                 std::span<const FileSegment> segments,
+                                 std::size_t fileSize) const override;
+
         void sendErrorEvent(std::string_view message) const override;
 
         void sendInMemDetectionEvent(std::string_view message) const override;
@@ -111,6 +160,11 @@ namespace VmiCore
         void initializePlugin(const std::string& pluginName,
                               std::shared_ptr<Plugin::IPluginConfig> config,
                               const std::vector<std::string>& args);
+
+        [[nodiscard]] std::function<void(std::shared_ptr<const ActiveProcessInformation>)> createAsyncCallback(
+            const std::function<void(std::shared_ptr<const ActiveProcessInformation>)>& callback);
+
+        void stopPluginEventDispatchers();
     };
 }
 
@@ -330,6 +330,35 @@ namespace VmiCore
         return physicalAddress;
     }
 
+    std::vector<FrameRun> LibvmiInterface::getFrameRuns(addr_t baseVA, addr_t dtb, std::size_t numberOfPages)
+    {
+        std::vector<FrameRun> frameRuns;
+        std::scoped_lock<std::mutex> lock(libvmiLock);
+        for (std::size_t page = 0; page < numberOfPages; page++)
+        {
+            auto virtualAddress = baseVA + page * PagingDefinitions::pageSizeInBytes;
+            addr_t physicalAddress = 0;
+            if (vmi_pagetable_lookup(vmiInstance, dtb, virtualAddress, &physicalAddress) != VMI_SUCCESS)
+            {
+                continue;
+            }
+
+            auto gfn = physicalAddress >> PagingDefinitions::numberOfPageIndexBits;
+            if (!frameRuns.empty())
+            {
+                auto& lastRun = frameRuns.back();
+                if (lastRun.guestBaseVA + lastRun.num_pages * PagingDefinitions::pageSizeInBytes == virtualAddress &&
+                    lastRun.firstGfn + lastRun.num_pages == gfn)
+                {
+                    lastRun.num_pages++;
+                    continue;
+                }
+            }
+            frameRuns.push_back({.guestBaseVA = virtualAddress, .firstGfn = gfn, .num_pages = 1});
+        }
+        return frameRuns;
+    }
+
     addr_t LibvmiInterface::convertPidToDtb(pid_t processID)
     {
         addr_t dtb = 0;
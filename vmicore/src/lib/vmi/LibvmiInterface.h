@@ -105,6 +105,8 @@ namespace VmiCore
 
         [[nodiscard]] addr_t convertVAToPA(addr_t virtualAddress, addr_t processCr3) override;
 
+        [[nodiscard]] std::vector<FrameRun> getFrameRuns(addr_t baseVA, addr_t dtb, std::size_t numberOfPages) override;
+
         [[nodiscard]] addr_t convertPidToDtb(pid_t processID) override;
 
         [[nodiscard]] pid_t convertDtbToPid(addr_t dtb) override;
@@ -0,0 +1,81 @@
+#include "MemorySnapshot.h"
+#include <algorithm>
+#include <fmt/core.h>
+#include <stdexcept>
+
+namespace VmiCore
+{
+    MemorySnapshot::MemorySnapshot(std::optional<SnapshotArenaLease> arena,
+                                   std::vector<MappedRegion> mappedRegions,
+                                   std::vector<SnapshotRegion> regions,
+                                   std::size_t snapshotSize)
+        : arena(std::move(arena)),
+          mappedRegions(std::move(mappedRegions)),
+          regions(std::move(regions)),
+          snapshotSize(snapshotSize)
+    {
+    }
+
+    std::unique_ptr<MemorySnapshot>
+    MemorySnapshot::create(SnapshotArenaPool& arenaPool,
+                           std::vector<std::pair<MemoryRegion, std::unique_ptr<IMemoryMapping>>> memoryRegionMappings)
+    {
+        std::size_t snapshotSize = 0;
+        std::size_t mappedRegionCount = 0;
+        for (const auto& [memoryRegion, memoryMapping] : memoryRegionMappings)
+        {
+            for (const auto& mappedRegion : memoryMapping->getMappedRegions())
+            {
+                snapshotSize += mappedRegion.asSpan().size();
+            }
+            mappedRegionCount += memoryMapping->getMappedRegions().size();
+        }
+
+        // Never waits for other snapshots to be released, as the guest is usually paused while taking a snapshot
+        auto arena = snapshotSize > 0 ? arenaPool.tryAcquire(snapshotSize) : std::nullopt;
+        if (snapshotSize > 0 && !arena)
+        {
+            throw std::length_error(fmt::format(
+                "Snapshot of {} bytes does not fit into the memory left by other snapshots", snapshotSize));
+        }
+
+        // Reserved up front so that the spans handed out to the regions are never invalidated
+        std::vector<MappedRegion> mappedRegions;
+        mappedRegions.reserve(mappedRegionCount);
+        std::vector<SnapshotRegion> regions;
+        regions.reserve(memoryRegionMappings.size());
+
+        std::size_t offset = 0;
+        for (auto& [memoryRegion, memoryMapping] : memoryRegionMappings)
+        {
+            auto firstMappedRegion = mappedRegions.size();
+            for (const auto& mappedRegion : memoryMapping->getMappedRegions())
+            {
+                auto source = mappedRegion.asSpan();
+                auto destination = arena->data().subspan(offset, source.size());
+                std::ranges::copy(source, destination.begin());
+                mappedRegions.emplace_back(mappedRegion.guestBaseVA, destination);
+                offset += source.size();
+            }
+            memoryMapping->unmap();
+
+            regions.push_back(SnapshotRegion{
+                .memoryRegionDescriptor = std::move(memoryRegion),
+                .mappedRegions = std::span(mappedRegions).subspan(firstMappedRegion,
+                                                                  mappedRegions.size() - firstMappedRegion)});
+        }
+
+        return std::unique_ptr<MemorySnapshot>(
+            new MemorySnapshot(std::move(arena), std::move(mappedRegions), std::move(regions), snapshotSize));
+    }
+
+    std::span<const SnapshotRegion> MemorySnapshot::getRegions() const
+    {
+        return regions;
+    }
+
+    std::size_t MemorySnapshot::size() const
+    {
+        return snapshotSize;
+    }
+}
@@ -0,0 +1,45 @@
+#ifndef VMICORE_MEMORYSNAPSHOT_H
+#define VMICORE_MEMORYSNAPSHOT_H
+
+#include "SnapshotArenaPool.h"
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+#include <vmicore/vmi/IMemoryMapping.h>
+#include <vmicore/vmi/IMemorySnapshot.h>
+
+namespace VmiCore
+{
+    class MemorySnapshot final : public IMemorySnapshot
+    {
+      public:
+        /**
+         * Copies all mapped regions into a single arena acquired from the given pool. Each mapping is released as soon
+         * as its content has been copied.
+         *
+         * @throws std::length_error If the pool cannot provide an arena without waiting for other snapshots.
+         */
+        static std::unique_ptr<MemorySnapshot>
+        create(SnapshotArenaPool& arenaPool,
+               std::vector<std::pair<MemoryRegion, std::unique_ptr<IMemoryMapping>>> memoryRegionMappings);
+
+        [[nodiscard]] std::span<const SnapshotRegion> getRegions() const override;
+
+        [[nodiscard]] std::size_t size() const override;
+
+      private:
+        std::optional<SnapshotArenaLease> arena;
+        // Referenced by the regions, must not be modified after construction
+        std::vector<MappedRegion> mappedRegions;
+        std::vector<SnapshotRegion> regions;
+        std::size_t snapshotSize;
+
+        MemorySnapshot(std::optional<SnapshotArenaLease> arena,
+                       std::vector<MappedRegion> mappedRegions,
+                       std::vector<SnapshotRegion> regions,
+                       std::size_t snapshotSize);
+    };
+}
+
+#endif // VMICORE_MEMORYSNAPSHOT_H
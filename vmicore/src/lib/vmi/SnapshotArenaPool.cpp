@@ -0,0 +1,182 @@
+#include "SnapshotArenaPool.h"
+#include <algorithm>
+#include <fmt/core.h>
+#include <new>
+#include <stdexcept>
+#include <sys/mman.h>
+
+namespace VmiCore
+{
+    namespace
+    {
+        constexpr std::size_t hugePageSize = 2 * 1024 * 1024;
+
+        std::size_t roundUpToHugePageSize(std::size_t size)
+        {
+            return (size + hugePageSize - 1) / hugePageSize * hugePageSize;
+        }
+    }
+
+    SnapshotArena::SnapshotArena(std::size_t capacity) : arenaCapacity(roundUpToHugePageSize(capacity))
+    {
+        auto* mapping =
+            mmap(nullptr, arenaCapacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (mapping != MAP_FAILED)
+        {
+            hugePageBacked = true;
+        }
+        else
+        {
+            // No explicit huge pages reserved on the host, fall back to transparent huge pages
+            mapping = mmap(nullptr, arenaCapacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (mapping == MAP_FAILED)
+            {
+                throw std::bad_alloc();
+            }
+            madvise(mapping, arenaCapacity, MADV_HUGEPAGE);
+        }
+        base = static_cast<uint8_t*>(mapping);
+    }
+
+    SnapshotArena::~SnapshotArena()
+    {
+        munmap(base, arenaCapacity);
+    }
+
+    std::span<uint8_t> SnapshotArena::data() const
+    {
+        return {base, arenaCapacity};
+    }
+
+    std::size_t SnapshotArena::capacity() const
+    {
+        return arenaCapacity;
+    }
+
+    bool SnapshotArena::isHugePageBacked() const
+    {
+        return hugePageBacked;
+    }
+
+    SnapshotArenaLease::SnapshotArenaLease(std::shared_ptr<SnapshotArenaPool> pool,
+                                           std::unique_ptr<SnapshotArena> arena)
+        : pool(std::move(pool)), arena(std::move(arena))
+    {
+    }
+
+    SnapshotArenaLease::~SnapshotArenaLease()
+    {
+        if (arena)
+        {
+            pool->release(std::move(arena));
+        }
+    }
+
+    std::span<uint8_t> SnapshotArenaLease::data() const
+    {
+        return arena->data();
+    }
+
+    SnapshotArenaPool::SnapshotArenaPool(std::size_t memoryLimit) : memoryLimit(memoryLimit) {}
+
+    SnapshotArenaLease SnapshotArenaPool::acquire(std::size_t size)
+    {
+        return *acquire(size, true);
+    }
+
+    std::optional<SnapshotArenaLease> SnapshotArenaPool::tryAcquire(std::size_t size)
+    {
+        return acquire(size, false);
+    }
+
+    std::size_t SnapshotArenaPool::getArenaSize(std::size_t size)
+    {
+        return roundUpToHugePageSize(size);
+    }
+
+    std::optional<SnapshotArenaLease> SnapshotArenaPool::acquire(std::size_t size, bool waitForRelease)
+    {
+        auto capacity = roundUpToHugePageSize(size);
+        if (capacity > memoryLimit)
+        {
+            throw std::length_error(
+                fmt::format("Snapshot of {} bytes exceeds the snapshot memory limit of {} bytes", size, memoryLimit));
+        }
+
+        {
+            std::unique_lock lock(poolLock);
+            while (true)
+            {
+                // Reuse the smallest free arena that is large enough
+                auto bestFit = std::ranges::min_element(
+                    freeArenas,
+                    [capacity](const auto& lhs, const auto& rhs)
+                    {
+                        auto lhsFits = lhs->capacity() >= capacity;
+                        auto rhsFits = rhs->capacity() >= capacity;
+                        return lhsFits != rhsFits ? lhsFits : lhs->capacity() < rhs->capacity();
+                    });
+                if (bestFit != freeArenas.end() && (*bestFit)->capacity() >= capacity)
+                {
+                    auto arena = std::move(*bestFit);
+                    freeArenas.erase(bestFit);
+                    return std::make_optional<SnapshotArenaLease>(shared_from_this(), std::move(arena));
+                }
+
+                // All free arenas are too small, release them in order to make room for a larger one
+                while (allocatedBytes + capacity > memoryLimit && !freeArenas.empty())
+                {
+                    allocatedBytes -= freeArenas.back()->capacity();
+                    freeArenas.pop_back();
+                }
+                if (allocatedBytes + capacity <= memoryLimit)
+                {
+                    allocatedBytes += capacity;
+                    break;
+                }
+                if (!waitForRelease)
+                {
+                    return std::nullopt;
+                }
+
+                arenaReleased.wait(lock);
+            }
+        }
+
+        // Allocate outside of the lock because mapping large arenas may take a while
+        try
+        {
+            return std::make_optional<SnapshotArenaLease>(shared_from_this(),
+                                                          std::make_unique<SnapshotArena>(capacity));
+        }
+        catch (const std::exception&)
+        {
+            {
+                std::scoped_lock lock(poolLock);
+                allocatedBytes -= capacity;
+            }
+            arenaReleased.notify_all();
+            throw;
+        }
+    }
+
+    std::size_t SnapshotArenaPool::getAllocatedBytes() const
+    {
+        std::scoped_lock lock(poolLock);
+        return allocatedBytes;
+    }
+
+    std::size_t SnapshotArenaPool::getMemoryLimit() const
+    {
+        return memoryLimit;
+    }
+
+    void SnapshotArenaPool::release(std::unique_ptr<SnapshotArena> arena)
+    {
+        {
+            std::scoped_lock lock(poolLock);
+            freeArenas.push_back(std::move(arena));
+        }
+        arenaReleased.notify_all();
+    }
+}
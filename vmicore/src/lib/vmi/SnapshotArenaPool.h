@@ -0,0 +1,121 @@
+#ifndef VMICORE_SNAPSHOTARENAPOOL_H
+#define VMICORE_SNAPSHOTARENAPOOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace VmiCore
+{
+    /**
+     * Contiguous block of anonymous memory serving as backing storage for memory snapshots. Explicit huge pages are
+     * used if the host has reserved any, otherwise transparent huge pages are requested.
+     */
+    class SnapshotArena
+    {
+      public:
+        explicit SnapshotArena(std::size_t capacity);
+
+        ~SnapshotArena();
+
+        SnapshotArena(const SnapshotArena&) = delete;
+
+        SnapshotArena(SnapshotArena&&) = delete;
+
+        SnapshotArena& operator=(const SnapshotArena&) = delete;
+
+        SnapshotArena& operator=(SnapshotArena&&) = delete;
+
+        [[nodiscard]] std::span<uint8_t> data() const;
+
+        [[nodiscard]] std::size_t capacity() const;
+
+        [[nodiscard]] bool isHugePageBacked() const;
+
+      private:
+        uint8_t* base = nullptr;
+        std::size_t arenaCapacity;
+        bool hugePageBacked = false;
+    };
+
+    class SnapshotArenaPool;
+
+    /**
+     * Grants exclusive use of an arena. The arena is returned to its pool on destruction.
+     */
+    class SnapshotArenaLease
+    {
+      public:
+        SnapshotArenaLease(std::shared_ptr<SnapshotArenaPool> pool, std::unique_ptr<SnapshotArena> arena);
+
+        ~SnapshotArenaLease();
+
+        SnapshotArenaLease(const SnapshotArenaLease&) = delete;
+
+        SnapshotArenaLease(SnapshotArenaLease&&) noexcept = default;
+
+        SnapshotArenaLease& operator=(const SnapshotArenaLease&) = delete;
+
+        SnapshotArenaLease& operator=(SnapshotArenaLease&&) = delete;
+
+        [[nodiscard]] std::span<uint8_t> data() const;
+
+      private:
+        std::shared_ptr<SnapshotArenaPool> pool;
+        std::unique_ptr<SnapshotArena> arena;
+    };
+
+    /**
+     * Recycles snapshot arenas so that taking a snapshot usually does not have to allocate and fault in memory. The
+     * combined capacity of all arenas is limited. Once the limit is reached, acquiring an arena blocks until enough
+     * leases have been returned, while trying to acquire one fails immediately. Has to be owned by a shared_ptr because
+     * leases keep the pool alive.
+     */
+    class SnapshotArenaPool : public std::enable_shared_from_this<SnapshotArenaPool>
+    {
+      public:
+        explicit SnapshotArenaPool(std::size_t memoryLimit);
+
+        /**
+         * @throws std::length_error If the requested size exceeds the memory limit of the pool.
+         */
+        [[nodiscard]] SnapshotArenaLease acquire(std::size_t size);
+
+        /**
+         * Like acquire, but does not wait for leases to be returned if the memory limit is reached.
+         *
+         * @return An empty optional if no arena is available without exceeding the memory limit.
+         * @throws std::length_error If the requested size exceeds the memory limit of the pool.
+         */
+        [[nodiscard]] std::optional<SnapshotArenaLease> tryAcquire(std::size_t size);
+
+        /**
+         * Size of the arena backing a snapshot of the given size, which is what counts towards the memory limit.
+         */
+        [[nodiscard]] static std::size_t getArenaSize(std::size_t size);
+
+        [[nodiscard]] std::size_t getAllocatedBytes() const;
+
+        [[nodiscard]] std::size_t getMemoryLimit() const;
+
+      private:
+        friend class SnapshotArenaLease;
+
+        std::size_t memoryLimit;
+        mutable std::mutex poolLock;
+        std::condition_variable arenaReleased;
+        std::vector<std::unique_ptr<SnapshotArena>> freeArenas;
+        std::size_t allocatedBytes = 0;
+
+        std::optional<SnapshotArenaLease> acquire(std::size_t size, bool waitForRelease);
+
+        void release(std::unique_ptr<SnapshotArena> arena);
+    };
+}
+
+#endif // VMICORE_SNAPSHOTARENAPOOL_H
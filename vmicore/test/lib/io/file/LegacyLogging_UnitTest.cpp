@@ -0,0 +1,96 @@
+#include "../../config/mock_ConfigInterface.h"
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <io/file/LegacyLogging.h>
+#include <iterator>
+#include <optional>
+#include <sys/stat.h>
+#include <vector>
+
+using testing::NiceMock;
+using testing::Return;
+
+namespace VmiCore
+{
+    class LegacyLoggingFixture : public testing::Test
+    {
+      protected:
+        std::filesystem::path resultsDirectory;
+        std::shared_ptr<NiceMock<MockConfigInterface>> configInterface =
+            std::make_shared<NiceMock<MockConfigInterface>>();
+        std::optional<LegacyLogging> legacyLogging;
+
+        void SetUp() override
+        {
+            resultsDirectory = std::filesystem::temp_directory_path() / "LegacyLogging_UnitTest" /
+                               testing::UnitTest::GetInstance()->current_test_info()->name();
+            std::filesystem::remove_all(resultsDirectory);
+            ON_CALL(*configInterface, getResultsDirectory()).WillByDefault(Return(resultsDirectory));
+            legacyLogging.emplace(configInterface);
+        }
+
+        void TearDown() override
+        {
+            std::filesystem::remove_all(resultsDirectory);
+        }
+
+        std::vector<uint8_t> readFile(const std::filesystem::path& fileName)
+        {
+            std::ifstream file(resultsDirectory / fileName, std::ios::binary);
+            return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+        }
+    };
+
+    TEST_F(LegacyLoggingFixture, appendToFile_severalChunks_chunksConcatenated)
+    {
+        std::array<uint8_t, 2> first{0x01, 0x02};
+        std::array<uint8_t, 1> second{0x03};
+
+        legacyLogging->appendToFile("dump/file", first);
+        legacyLogging->appendToFile("dump/file", second);
+
+        EXPECT_EQ(readFile("dump/file"), (std::vector<uint8_t>{0x01, 0x02, 0x03}));
+    }
+
+    TEST_F(LegacyLoggingFixture, saveSegmentsToFile_segmentsWithGaps_gapsReadAsZero)
+    {
+        std::array<uint8_t, 2> first{0x01, 0x02};
+        std::array<uint8_t, 3> second{0x03, 0x04, 0x05};
+        std::array segments{FileSegment{0, first}, FileSegment{4, second}};
+        std::vector<uint8_t> expectedContent{0x01, 0x02, 0x00, 0x00, 0x03, 0x04, 0x05, 0x00};
+
+        legacyLogging->saveSegmentsToFile("dump/file", segments, expectedContent.size());
+
+        EXPECT_EQ(readFile("dump/file"), expectedContent);
+    }
+
+    TEST_F(LegacyLoggingFixture, saveSegmentsToFile_existingFile_fileReplaced)
+    {
+        legacyLogging->saveBinaryToFile("file", std::vector<uint8_t>(16, 0xFF));
+        std::array<uint8_t, 1> data{0x01};
+        std::array segments{FileSegment{0, data}};
+
+        legacyLogging->saveSegmentsToFile("file", segments, data.size());
+
+        EXPECT_EQ(readFile("file"), std::vector<uint8_t>{0x01});
+    }
+
+    TEST_F(LegacyLoggingFixture, saveSegmentsToFile_largeGap_gapNotAllocated)
+    {
+        constexpr std::size_t gapSize = 64 * 1024 * 1024;
+        std::array<uint8_t, 1> data{0x01};
+        std::array segments{FileSegment{gapSize, data}};
+
+        legacyLogging->saveSegmentsToFile("file", segments, gapSize + data.size());
+
+        struct stat fileStatus
+        {
+        };
+        ASSERT_EQ(stat((resultsDirectory / "file").c_str(), &fileStatus), 0);
+        EXPECT_EQ(static_cast<std::size_t>(fileStatus.st_size), gapSize + data.size());
+        EXPECT_LT(static_cast<std::size_t>(fileStatus.st_blocks) * 512, gapSize);
+    }
+}
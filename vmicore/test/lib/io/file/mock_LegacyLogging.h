@@ -13,6 +13,13 @@ namespace VmiCore
                     saveBinaryToFile,
                     (std::string_view logFileName, const std::vector<uint8_t>& data),
                     (override));
+
+        MOCK_METHOD(void, appendToFile, (std::string_view fileName, std::span<const uint8_t> data), (override));
+
+        MOCK_METHOD(void,
+                    saveSegmentsToFile,
+                    (std::string_view fileName, std::span<const FileSegment> segments, std::size_t fileSize),
+                    (override));
     };
 }
 
@@ -0,0 +1,89 @@
+#include "../io/mock_Logging.h"
+#include <atomic>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <os/ProcessEventDispatcher.h>
+#include <vector>
+#include <vmicore_test/io/mock_Logger.h>
+
+using testing::_;
+using testing::ElementsAre;
+using testing::NiceMock;
+
+namespace VmiCore
+{
+    class ProcessEventDispatcherFixture : public testing::Test
+    {
+      protected:
+        std::shared_ptr<NiceMock<MockLogging>> logging = std::make_shared<NiceMock<MockLogging>>();
+
+        void SetUp() override
+        {
+            ON_CALL(*logging, newNamedLogger(_))
+                .WillByDefault([](std::string_view) { return std::make_unique<NiceMock<MockLogger>>(); });
+        }
+    };
+
+    TEST_F(ProcessEventDispatcherFixture, post_multipleTasks_executedInSubmissionOrder)
+    {
+        std::vector<int> executionOrder;
+        ProcessEventDispatcher processEventDispatcher(logging, 2);
+
+        for (int i = 0; i < 10; i++)
+        {
+            processEventDispatcher.post([&executionOrder, i]() { executionOrder.push_back(i); });
+        }
+        processEventDispatcher.stop();
+
+        EXPECT_THAT(executionOrder, ElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 9));
+    }
+
+    TEST_F(ProcessEventDispatcherFixture, postAndWait_pendingTasks_previousTasksCompleted)
+    {
+        std::atomic<int> completedTasks = 0;
+        ProcessEventDispatcher processEventDispatcher(logging, 4);
+        processEventDispatcher.post([&completedTasks]() { completedTasks++; });
+        processEventDispatcher.post([&completedTasks]() { completedTasks++; });
+
+        processEventDispatcher.postAndWait([]() {});
+
+        EXPECT_EQ(completedTasks, 2);
+    }
+
+    TEST_F(ProcessEventDispatcherFixture, postAndWait_throwingTask_exceptionRethrown)
+    {
+        ProcessEventDispatcher processEventDispatcher(logging, 1);
+
+        EXPECT_THROW(processEventDispatcher.postAndWait([]() { throw std::runtime_error("Failure"); }),
+                     std::runtime_error);
+    }
+
+    TEST_F(ProcessEventDispatcherFixture, post_throwingTask_subsequentTasksExecuted)
+    {
+        bool executed = false;
+        ProcessEventDispatcher processEventDispatcher(logging, 1);
+
+        processEventDispatcher.post([]() { throw std::runtime_error("Failure"); });
+        processEventDispatcher.postAndWait([&executed]() { executed = true; });
+
+        EXPECT_TRUE(executed);
+    }
+
+    TEST_F(ProcessEventDispatcherFixture, post_stoppedDispatcher_throws)
+    {
+        ProcessEventDispatcher processEventDispatcher(logging, 1);
+        processEventDispatcher.stop();
+
+        EXPECT_THROW(processEventDispatcher.post([]() {}), std::runtime_error);
+    }
+
+    TEST_F(ProcessEventDispatcherFixture, tryPost_stoppedDispatcher_taskDropped)
+    {
+        bool executed = false;
+        ProcessEventDispatcher processEventDispatcher(logging, 1);
+        processEventDispatcher.stop();
+
+        EXPECT_FALSE(processEventDispatcher.tryPost([&executed]() { executed = true; }));
+        EXPECT_FALSE(executed);
+    }
+}
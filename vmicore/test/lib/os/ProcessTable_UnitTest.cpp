@@ -0,0 +1,140 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <os/ProcessTable.h>
+
+using testing::ElementsAre;
+using testing::IsEmpty;
+
+namespace VmiCore
+{
+    namespace
+    {
+        std::shared_ptr<ActiveProcessInformation> createProcessInformation(uint64_t base, pid_t pid)
+        {
+            auto processInformation = std::make_shared<ActiveProcessInformation>();
+            processInformation->base = base;
+            processInformation->pid = pid;
+            return processInformation;
+        }
+    }
+
+    TEST(ProcessTableTest, withProcess_activeProcess_processAddedToNewTableOnly)
+    {
+        auto processTable = std::make_shared<const ProcessTable>();
+        auto processInformation = createProcessInformation(0x1000, 4);
+
+        auto updatedProcessTable = processTable->withProcess(processInformation, true);
+
+        EXPECT_EQ(updatedProcessTable->findByPid(4), processInformation);
+        EXPECT_EQ(updatedProcessTable->findPidByBase(0x1000), 4);
+        EXPECT_THAT(*updatedProcessTable->getActiveProcesses(), ElementsAre(processInformation));
+        EXPECT_EQ(processTable->findByPid(4), nullptr);
+        EXPECT_THAT(*processTable->getActiveProcesses(), IsEmpty());
+    }
+
+    TEST(ProcessTableTest, withProcess_inactiveProcess_processNotActive)
+    {
+        auto processInformation = createProcessInformation(0x1000, 4);
+
+        auto processTable = std::make_shared<const ProcessTable>()->withProcess(processInformation, false);
+
+        EXPECT_EQ(processTable->findByPid(4), processInformation);
+        EXPECT_THAT(*processTable->getActiveProcesses(), IsEmpty());
+    }
+
+    TEST(ProcessTableTest, withProcess_reusedPid_previousProcessReplaced)
+    {
+        auto previousProcessInformation = createProcessInformation(0x1000, 4);
+        auto processInformation = createProcessInformation(0x2000, 4);
+
+        auto processTable = std::make_shared<const ProcessTable>()
+                                ->withProcess(previousProcessInformation, true)
+                                ->withProcess(processInformation, true);
+
+        EXPECT_EQ(processTable->findByPid(4), processInformation);
+        EXPECT_THAT(*processTable->getActiveProcesses(), ElementsAre(processInformation));
+    }
+
+    TEST(ProcessTableTest, withoutProcess_presentProcess_processRemovedFromNewTableOnly)
+    {
+        auto processInformation = createProcessInformation(0x1000, 4);
+        auto processTable = std::make_shared<const ProcessTable>()->withProcess(processInformation, true);
+
+        auto updatedProcessTable = processTable->withoutProcess(0x1000);
+
+        EXPECT_EQ(updatedProcessTable->findByPid(4), nullptr);
+        EXPECT_EQ(updatedProcessTable->findPidByBase(0x1000), std::nullopt);
+        EXPECT_THAT(*updatedProcessTable->getActiveProcesses(), IsEmpty());
+        EXPECT_THAT(*processTable->getActiveProcesses(), ElementsAre(processInformation));
+    }
+
+    TEST(ProcessTableTest, withThread_presentProcess_threadResolvesToProcess)
+    {
+        auto processInformation = createProcessInformation(0x1000, 4);
+
+        auto processTable =
+            std::make_shared<const ProcessTable>()->withProcess(processInformation, true)->withThread(0x2000, 4, 5);
+
+        EXPECT_EQ(processTable->findPidByBase(0x2000), 4);
+        EXPECT_EQ(processTable->findThreadIdByBase(0x2000), 5);
+        EXPECT_EQ(processTable->findThreadIdByBase(0x1000), std::nullopt);
+        EXPECT_THAT(*processTable->getActiveProcesses(), ElementsAre(processInformation));
+    }
+
+    TEST(ProcessTableTest, withoutProcess_thread_processKept)
+    {
+        auto processInformation = createProcessInformation(0x1000, 4);
+        auto processTable =
+            std::make_shared<const ProcessTable>()->withProcess(processInformation, true)->withThread(0x2000, 4, 5);
+
+        auto updatedProcessTable = processTable->withoutProcess(0x2000);
+
+        EXPECT_EQ(updatedProcessTable->findPidByBase(0x2000), std::nullopt);
+        EXPECT_EQ(updatedProcessTable->findThreadIdByBase(0x2000), std::nullopt);
+        EXPECT_EQ(updatedProcessTable->findByPid(4), processInformation);
+        EXPECT_THAT(*updatedProcessTable->getActiveProcesses(), ElementsAre(processInformation));
+    }
+
+    TEST(ProcessTableTest, withoutProcess_leaderOfProcessWithThread_processKeptForThread)
+    {
+        auto processInformation = createProcessInformation(0x1000, 4);
+        auto processTable =
+            std::make_shared<const ProcessTable>()->withProcess(processInformation, true)->withThread(0x2000, 4, 5);
+
+        auto updatedProcessTable = processTable->withoutProcess(0x1000);
+
+        EXPECT_EQ(updatedProcessTable->findPidByBase(0x1000), std::nullopt);
+        EXPECT_EQ(updatedProcessTable->findPidByBase(0x2000), 4);
+        EXPECT_EQ(updatedProcessTable->findByPid(4), processInformation);
+        EXPECT_THAT(*updatedProcessTable->getActiveProcesses(), ElementsAre(processInformation));
+    }
+
+    TEST(ProcessTableTest, withoutProcess_lastThreadAfterLeader_processRemoved)
+    {
+        auto processTable = std::make_shared<const ProcessTable>()
+                                ->withProcess(createProcessInformation(0x1000, 4), true)
+                                ->withThread(0x2000, 4, 5)
+                                ->withoutProcess(0x1000);
+
+        auto updatedProcessTable = processTable->withoutProcess(0x2000);
+
+        EXPECT_EQ(updatedProcessTable->findPidByBase(0x2000), std::nullopt);
+        EXPECT_EQ(updatedProcessTable->findByPid(4), nullptr);
+        EXPECT_THAT(*updatedProcessTable->getActiveProcesses(), IsEmpty());
+    }
+
+    TEST(ProcessTableTest, withProcess_reusedPidOfProcessWithThread_threadRemoved)
+    {
+        auto processInformation = createProcessInformation(0x2000, 4);
+
+        auto processTable = std::make_shared<const ProcessTable>()
+                                ->withProcess(createProcessInformation(0x1000, 4), true)
+                                ->withThread(0x3000, 4, 5)
+                                ->withProcess(processInformation, true);
+
+        EXPECT_EQ(processTable->findPidByBase(0x1000), std::nullopt);
+        EXPECT_EQ(processTable->findPidByBase(0x3000), std::nullopt);
+        EXPECT_EQ(processTable->findThreadIdByBase(0x3000), std::nullopt);
+        EXPECT_EQ(processTable->findByPid(4), processInformation);
+    }
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include <os/linux/DentryPathCache.h>
+
+namespace VmiCore::Linux
+{
+    namespace
+    {
+        constexpr uint64_t dentry = 0xffff888000001000;
+        constexpr uint64_t mnt = 0xffff888000002000;
+        constexpr DentryValidationToken validationToken{.nameAddress = 0xffff888000001038,
+                                                        .parent = 0xffff888000003000,
+                                                        .inode = 0xffff888000004000,
+                                                        .sequence = 2};
+        constexpr uint32_t renameSequence = 6;
+    }
+
+    TEST(DentryPathCacheTest, find_matchingValidationToken_cachedPath)
+    {
+        DentryPathCache pathCache{};
+        pathCache.insert(dentry, mnt, validationToken, renameSequence, "/usr/lib");
+
+        EXPECT_EQ(pathCache.find(dentry, mnt, validationToken, renameSequence), "/usr/lib");
+    }
+
+    TEST(DentryPathCacheTest, find_differentMount_noPath)
+    {
+        DentryPathCache pathCache{};
+        pathCache.insert(dentry, mnt, validationToken, renameSequence, "/usr/lib");
+
+        EXPECT_EQ(pathCache.find(dentry, mnt + 0x100, validationToken, renameSequence), std::nullopt);
+    }
+
+    TEST(DentryPathCacheTest, find_renamedDentry_staleEntryRemoved)
+    {
+        DentryPathCache pathCache{};
+        pathCache.insert(dentry, mnt, validationToken, renameSequence, "/usr/lib");
+        auto renamedToken = validationToken;
+        renamedToken.sequence = 4;
+
+        EXPECT_EQ(pathCache.find(dentry, mnt, renamedToken, renameSequence), std::nullopt);
+        EXPECT_EQ(pathCache.size(), 0);
+    }
+
+    TEST(DentryPathCacheTest, find_dentryReusedWithInlineNameAndResetSequence_staleEntryRemoved)
+    {
+        DentryPathCache pathCache{};
+        auto firstUseToken = validationToken;
+        firstUseToken.sequence = 0;
+        pathCache.insert(dentry, mnt, firstUseToken, renameSequence, "/usr/lib");
+        // The reallocated dentry keeps its inline name buffer and starts over with a zero sequence count
+        auto reusedToken = firstUseToken;
+        reusedToken.parent = 0xffff888000005000;
+        reusedToken.inode = 0xffff888000006000;
+
+        EXPECT_EQ(pathCache.find(dentry, mnt, reusedToken, renameSequence), std::nullopt);
+        EXPECT_EQ(pathCache.size(), 0);
+    }
+
+    TEST(DentryPathCacheTest, find_dentryWithNewInode_staleEntryRemoved)
+    {
+        DentryPathCache pathCache{};
+        pathCache.insert(dentry, mnt, validationToken, renameSequence, "/usr/lib");
+        auto reusedToken = validationToken;
+        reusedToken.inode = 0xffff888000007000;
+
+        EXPECT_EQ(pathCache.find(dentry, mnt, reusedToken, renameSequence), std::nullopt);
+    }
+
+    TEST(DentryPathCacheTest, find_renameSequenceChanged_allEntriesRemoved)
+    {
+        DentryPathCache pathCache{};
+        pathCache.insert(dentry, mnt, validationToken, renameSequence, "/usr/lib");
+        pathCache.insert(dentry + 0x100, mnt, validationToken, renameSequence, "/usr/lib/libc.so.6");
+
+        EXPECT_EQ(pathCache.find(dentry, mnt, validationToken, renameSequence + 2), std::nullopt);
+        EXPECT_EQ(pathCache.size(), 0);
+    }
+
+    TEST(DentryPathCacheTest, insert_maxEntriesReached_cacheStartsOver)
+    {
+        DentryPathCache pathCache{};
+        for (uint64_t i = 0; i < DentryPathCache::maxEntries; i++)
+        {
+            pathCache.insert(dentry + i, mnt, validationToken, renameSequence, "/");
+        }
+
+        pathCache.insert(dentry - 1, mnt, validationToken, renameSequence, "/");
+
+        EXPECT_EQ(pathCache.size(), 1);
+    }
+}
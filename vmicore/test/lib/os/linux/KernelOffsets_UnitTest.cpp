@@ -0,0 +1,175 @@
+#include "../../vmi/mock_LibvmiInterface.h"
+#include <fmt/core.h>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <map>
+#include <os/linux/KernelOffsets.h>
+#include <vmicore/vmi/VmiException.h>
+
+using testing::_;
+using testing::NiceMock;
+using testing::Return;
+
+namespace VmiCore::Linux
+{
+    namespace
+    {
+        using KernelProfileMembers = std::map<std::pair<std::string, std::string>, addr_t>;
+
+        const KernelProfileMembers commonMembers{{{"task_struct", "mm"}, 0x8e0},
+                                                 {{"task_struct", "real_parent"}, 0x9a0},
+                                                 {{"task_struct", "tgid"}, 0x994},
+                                                 {{"mm_struct", "exe_file"}, 0x3a8},
+                                                 {{"vm_area_struct", "vm_start"}, 0x0},
+                                                 {{"vm_area_struct", "vm_end"}, 0x8},
+                                                 {{"vm_area_struct", "vm_flags"}, 0x20},
+                                                 {{"vm_area_struct", "vm_file"}, 0x90},
+                                                 {{"file", "f_path"}, 0x10},
+                                                 {{"path", "mnt"}, 0x0},
+                                                 {{"path", "dentry"}, 0x8},
+                                                 {{"mount", "mnt"}, 0x20},
+                                                 {{"mount", "mnt_mountpoint"}, 0x18},
+                                                 {{"mount", "mnt_parent"}, 0x10},
+                                                 {{"dentry", "d_name"}, 0x20},
+                                                 {{"dentry", "d_parent"}, 0x18},
+                                                 {{"dentry", "d_inode"}, 0x30},
+                                                 {{"dentry", "d_seq"}, 0x4},
+                                                 {{"qstr", "name"}, 0x8}};
+
+        const KernelProfileMembers listMembers{{{"mm_struct", "mmap"}, 0x0}, {{"vm_area_struct", "vm_next"}, 0x10}};
+
+        const KernelProfileMembers threadGroupMembers{{{"task_struct", "signal"}, 0xa88},
+                                                      {{"task_struct", "thread_node"}, 0xa40},
+                                                      {{"signal_struct", "thread_head"}, 0x10}};
+
+        const KernelProfileMembers mapleTreeMembers{{{"mm_struct", "mm_mt"}, 0x40},
+                                                    {{"maple_tree", "ma_root"}, 0x8},
+                                                    {{"maple_range_64", "pivot"}, 0x8},
+                                                    {{"maple_range_64", "slot"}, 0x80},
+                                                    {{"maple_arange_64", "pivot"}, 0x8},
+                                                    {{"maple_arange_64", "slot"}, 0x58}};
+
+        std::shared_ptr<NiceMock<MockLibvmiInterface>> createVmiInterfaceWithProfile(KernelProfileMembers members)
+        {
+            auto vmiInterface = std::make_shared<NiceMock<MockLibvmiInterface>>();
+            ON_CALL(*vmiInterface, isInitialized()).WillByDefault(Return(true));
+            ON_CALL(*vmiInterface, getStructSizeFromJson("vm_area_struct")).WillByDefault(Return(0xb8));
+            ON_CALL(*vmiInterface, getKernelStructOffset(_, _))
+                .WillByDefault(
+                    [members = std::move(members)](const std::string& structName, const std::string& member)
+                    {
+                        if (auto offset = members.find({structName, member}); offset != members.end())
+                        {
+                            return offset->second;
+                        }
+                        throw VmiException(fmt::format("Member {}.{} not in profile", structName, member));
+                    });
+            return vmiInterface;
+        }
+
+        KernelProfileMembers mergeMembers(KernelProfileMembers members, const KernelProfileMembers& additionalMembers)
+        {
+            members.insert(additionalMembers.begin(), additionalMembers.end());
+            return members;
+        }
+    }
+
+    TEST(KernelOffsetsTest, init_vmiNotInitialized_throws)
+    {
+        auto vmiInterface = std::make_shared<NiceMock<MockLibvmiInterface>>();
+        ON_CALL(*vmiInterface, isInitialized()).WillByDefault(Return(false));
+
+        EXPECT_THROW(KernelOffsets::init(vmiInterface), std::invalid_argument);
+    }
+
+    TEST(KernelOffsetsTest, init_profileWithVmaList_offsetsResolvedWithoutMapleTree)
+    {
+        auto vmiInterface = createVmiInterfaceWithProfile(mergeMembers(commonMembers, listMembers));
+
+        auto kernelOffsets = KernelOffsets::init(vmiInterface);
+
+        EXPECT_EQ(kernelOffsets.taskStruct.mm, 0x8e0);
+        EXPECT_EQ(kernelOffsets.taskStruct.real_parent, 0x9a0);
+        EXPECT_EQ(kernelOffsets.taskStruct.tgid, 0x994);
+        EXPECT_EQ(kernelOffsets.mmStruct.exe_file, 0x3a8);
+        EXPECT_EQ(kernelOffsets.mmStruct.mmap, 0x0);
+        EXPECT_FALSE(kernelOffsets.mmStruct.mm_mt);
+        EXPECT_EQ(kernelOffsets.vmAreaStruct.size, 0xb8);
+        EXPECT_EQ(kernelOffsets.vmAreaStruct.vm_flags, 0x20);
+        EXPECT_EQ(kernelOffsets.vmAreaStruct.vm_next, 0x10);
+        EXPECT_FALSE(kernelOffsets.mapleTree);
+        EXPECT_EQ(kernelOffsets.mount.mnt_mountpoint, 0x18);
+        EXPECT_EQ(kernelOffsets.dentry.d_parent, 0x18);
+        EXPECT_EQ(kernelOffsets.dentry.d_inode, 0x30);
+        EXPECT_EQ(kernelOffsets.dentry.d_seq, 0x4);
+        EXPECT_EQ(kernelOffsets.qstr.name, 0x8);
+    }
+
+    TEST(KernelOffsetsTest, init_profileWithMapleTree_mapleTreeOffsetsResolved)
+    {
+        auto vmiInterface = createVmiInterfaceWithProfile(mergeMembers(commonMembers, mapleTreeMembers));
+
+        auto kernelOffsets = KernelOffsets::init(vmiInterface);
+
+        EXPECT_FALSE(kernelOffsets.mmStruct.mmap);
+        EXPECT_EQ(kernelOffsets.mmStruct.mm_mt, 0x40);
+        EXPECT_FALSE(kernelOffsets.vmAreaStruct.vm_next);
+        ASSERT_TRUE(kernelOffsets.mapleTree);
+        EXPECT_EQ(kernelOffsets.mapleTree->ma_root, 0x8);
+        EXPECT_EQ(kernelOffsets.mapleTree->range64Slot, 0x80);
+        EXPECT_EQ(kernelOffsets.mapleTree->arange64Slot, 0x58);
+    }
+
+    TEST(KernelOffsetsTest, init_profileWithThreadList_threadGroupOffsetsResolved)
+    {
+        auto vmiInterface =
+            createVmiInterfaceWithProfile(mergeMembers(mergeMembers(commonMembers, listMembers), threadGroupMembers));
+
+        auto kernelOffsets = KernelOffsets::init(vmiInterface);
+
+        ASSERT_TRUE(kernelOffsets.threadGroup);
+        EXPECT_EQ(kernelOffsets.threadGroup->signal, 0xa88);
+        EXPECT_EQ(kernelOffsets.threadGroup->thread_head, 0x10);
+        EXPECT_EQ(kernelOffsets.threadGroup->thread_node, 0xa40);
+    }
+
+    TEST(KernelOffsetsTest, init_profileWithoutThreadList_noThreadGroupOffsets)
+    {
+        auto vmiInterface = createVmiInterfaceWithProfile(mergeMembers(commonMembers, listMembers));
+
+        auto kernelOffsets = KernelOffsets::init(vmiInterface);
+
+        EXPECT_FALSE(kernelOffsets.threadGroup);
+    }
+
+    TEST(KernelOffsetsTest, init_profileWithoutOptionalDentrySequence_noSequenceOffset)
+    {
+        auto members = mergeMembers(commonMembers, listMembers);
+        members.erase({"dentry", "d_seq"});
+        auto vmiInterface = createVmiInterfaceWithProfile(members);
+
+        auto kernelOffsets = KernelOffsets::init(vmiInterface);
+
+        EXPECT_FALSE(kernelOffsets.dentry.d_seq);
+    }
+
+    TEST(KernelOffsetsTest, init_renameLockSymbolMissing_noRenameLockAddress)
+    {
+        auto vmiInterface = createVmiInterfaceWithProfile(mergeMembers(commonMembers, listMembers));
+        ON_CALL(*vmiInterface, translateKernelSymbolToVA("rename_lock"))
+            .WillByDefault([](const std::string&) -> addr_t { throw VmiException("Symbol not in profile"); });
+
+        auto kernelOffsets = KernelOffsets::init(vmiInterface);
+
+        EXPECT_FALSE(kernelOffsets.renameLockVA);
+    }
+
+    TEST(KernelOffsetsTest, init_profileWithoutRequiredMember_throws)
+    {
+        auto members = mergeMembers(commonMembers, listMembers);
+        members.erase({"task_struct", "mm"});
+        auto vmiInterface = createVmiInterfaceWithProfile(members);
+
+        EXPECT_THROW(KernelOffsets::init(vmiInterface), VmiException);
+    }
+}
@@ -0,0 +1,67 @@
+#include "../../vmi/mock_LibvmiInterface.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <os/linux/KernelProfile.h>
+#include <os/linux/MapleTreeWalker.h>
+#include <os/linux/VmAreaListWalker.h>
+#include <vmicore/vmi/VmiException.h>
+
+using testing::_;
+using testing::NiceMock;
+using testing::Return;
+using testing::StrEq;
+
+namespace VmiCore::Linux
+{
+    namespace
+    {
+        constexpr auto bannerVA = 0xffffffff82000000;
+
+        std::shared_ptr<NiceMock<MockLibvmiInterface>> createVmiInterfaceWithBanner(const std::string& banner)
+        {
+            auto vmiInterface = std::make_shared<NiceMock<MockLibvmiInterface>>();
+            ON_CALL(*vmiInterface, translateKernelSymbolToVA(StrEq("linux_banner"))).WillByDefault(Return(bannerVA));
+            ON_CALL(*vmiInterface, extractStringAtVA(bannerVA, _))
+                .WillByDefault([banner](addr_t, addr_t) { return std::make_unique<std::string>(banner); });
+            return vmiInterface;
+        }
+    }
+
+    TEST(KernelProfileTest, parseKernelVersion_validBanner_version)
+    {
+        EXPECT_EQ(KernelProfile::parseKernelVersion("Linux version 5.15.0-91-generic (buildd@lcy02-amd64-045)"),
+                  (KernelVersion{.major = 5, .minor = 15, .patch = 0}));
+    }
+
+    TEST(KernelProfileTest, parseKernelVersion_invalidBanner_throws)
+    {
+        EXPECT_THROW(auto version = KernelProfile::parseKernelVersion("Windows"), std::runtime_error);
+    }
+
+    TEST(KernelProfileTest, init_kernelBeforeMapleTree_listWalker)
+    {
+        auto vmiInterface = createVmiInterfaceWithBanner("Linux version 4.19.0");
+        KernelOffsets kernelOffsets{.mmStruct = {.mmap = 0x0}, .vmAreaStruct = {.vm_next = 0x10}};
+
+        auto kernelProfile = KernelProfile::init(vmiInterface, kernelOffsets);
+
+        EXPECT_NE(std::dynamic_pointer_cast<const VmAreaListWalker>(kernelProfile.vmAreaWalker), nullptr);
+    }
+
+    TEST(KernelProfileTest, init_kernelWithMapleTree_mapleTreeWalker)
+    {
+        auto vmiInterface = createVmiInterfaceWithBanner("Linux version 6.5.0");
+        KernelOffsets kernelOffsets{.mmStruct = {.mm_mt = 0x40}, .mapleTree = KernelStructOffsets::maple_tree{}};
+
+        auto kernelProfile = KernelProfile::init(vmiInterface, kernelOffsets);
+
+        EXPECT_NE(std::dynamic_pointer_cast<const MapleTreeWalker>(kernelProfile.vmAreaWalker), nullptr);
+    }
+
+    TEST(KernelProfileTest, init_mapleTreeKernelWithoutMapleTreeOffsets_throws)
+    {
+        auto vmiInterface = createVmiInterfaceWithBanner("Linux version 6.1.0");
+
+        EXPECT_THROW(auto kernelProfile = KernelProfile::init(vmiInterface, KernelOffsets{}), VmiException);
+    }
+}
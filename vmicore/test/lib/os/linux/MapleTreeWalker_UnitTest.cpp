@@ -0,0 +1,199 @@
+#include "../../vmi/mock_LibvmiInterface.h"
+#include <cstring>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <limits>
+#include <map>
+#include <os/linux/Constants.h>
+#include <os/linux/MapleTreeWalker.h>
+#include <vmicore/vmi/VmiException.h>
+
+using testing::_;
+using testing::ElementsAre;
+using testing::IsEmpty;
+using testing::NiceMock;
+using testing::Return;
+
+namespace VmiCore::Linux
+{
+    namespace
+    {
+        constexpr addr_t systemDtb = 0x1aa000;
+        constexpr uint64_t mm = 0xffff888100000000;
+        constexpr addr_t mmMapleTreeOffset = 0x40;
+        constexpr KernelStructOffsets::maple_tree mapleTreeOffsets{
+            .ma_root = 0x8, .range64Pivot = 0x8, .range64Slot = 0x80, .arange64Pivot = 0x8, .arange64Slot = 0x50};
+
+        uint64_t encodeNode(addr_t nodeAddress, MapleType type)
+        {
+            return nodeAddress | (static_cast<uint64_t>(type) << MAPLE_NODE_TYPE_SHIFT) | 2;
+        }
+    }
+
+    class MapleTreeWalkerFixture : public testing::Test
+    {
+      protected:
+        std::shared_ptr<NiceMock<MockLibvmiInterface>> vmiInterface = std::make_shared<NiceMock<MockLibvmiInterface>>();
+        std::map<addr_t, std::vector<uint8_t>> guestNodes{};
+
+        void SetUp() override
+        {
+            ON_CALL(*vmiInterface, convertPidToDtb(SYSTEM_PID)).WillByDefault(Return(systemDtb));
+            ON_CALL(*vmiInterface, readXVA(_, systemDtb, _, MAPLE_NODE_SIZE))
+                .WillByDefault(
+                    [this](uint64_t virtualAddress, uint64_t, std::vector<uint8_t>& content, std::size_t size)
+                    {
+                        auto node = guestNodes.find(virtualAddress);
+                        if (node == guestNodes.end())
+                        {
+                            return false;
+                        }
+                        std::memcpy(content.data(), node->second.data(), size);
+                        return true;
+                    });
+        }
+
+        void setupRoot(uint64_t root)
+        {
+            ON_CALL(*vmiInterface, read64VA(mm + mmMapleTreeOffset + mapleTreeOffsets.ma_root, systemDtb))
+                .WillByDefault(Return(root));
+        }
+
+        void setupNode(addr_t nodeAddress,
+                       MapleType type,
+                       const std::vector<uint64_t>& pivots,
+                       const std::vector<uint64_t>& slots)
+        {
+            const auto isArange = type == MapleType::maple_arange_64;
+            const auto pivotOffset = isArange ? mapleTreeOffsets.arange64Pivot : mapleTreeOffsets.range64Pivot;
+            const auto slotOffset = isArange ? mapleTreeOffsets.arange64Slot : mapleTreeOffsets.range64Slot;
+
+            std::vector<uint8_t> node(MAPLE_NODE_SIZE);
+            std::memcpy(node.data() + pivotOffset, pivots.data(), pivots.size() * sizeof(uint64_t));
+            std::memcpy(node.data() + slotOffset, slots.data(), slots.size() * sizeof(uint64_t));
+            guestNodes[nodeAddress] = std::move(node);
+        }
+
+        [[nodiscard]] std::vector<addr_t> collectVmAreas() const
+        {
+            KernelOffsets kernelOffsets{.mmStruct = {.mm_mt = mmMapleTreeOffset}, .mapleTree = mapleTreeOffsets};
+            MapleTreeWalker walker(vmiInterface, kernelOffsets);
+            return walker.collectVmAreas(mm);
+        }
+    };
+
+    TEST_F(MapleTreeWalkerFixture, collectVmAreas_emptyTree_noAreas)
+    {
+        setupRoot(0);
+
+        EXPECT_THAT(collectVmAreas(), IsEmpty());
+    }
+
+    TEST_F(MapleTreeWalkerFixture, collectVmAreas_directEntryRoot_singleArea)
+    {
+        setupRoot(0xffff888104a2c000);
+
+        EXPECT_THAT(collectVmAreas(), ElementsAre(0xffff888104a2c000));
+    }
+
+    TEST_F(MapleTreeWalkerFixture, collectVmAreas_leafRoot_areasUntilEndOfData)
+    {
+        setupRoot(encodeNode(0xffff888102000000, MapleType::maple_leaf_64));
+        setupNode(0xffff888102000000,
+                  MapleType::maple_leaf_64,
+                  {0x3fffff, 0x400fff, 0x7fffff, 0x800fff, 0},
+                  {0, 0xffff888104a2c000, 0, 0xffff888104a2c100, 0xffff888104a2c200});
+
+        EXPECT_THAT(collectVmAreas(), ElementsAre(0xffff888104a2c000, 0xffff888104a2c100));
+    }
+
+    TEST_F(MapleTreeWalkerFixture, collectVmAreas_fullLeafRoot_lastSlotBoundedByMaximum)
+    {
+        std::vector<uint64_t> pivots{};
+        std::vector<uint64_t> slots{};
+        std::vector<addr_t> expectedAreas{};
+        for (uint64_t i = 0; i < MAPLE_RANGE64_SLOTS; i++)
+        {
+            if (i < MAPLE_RANGE64_SLOTS - 1)
+            {
+                pivots.push_back((i + 1) * 0x1000 - 1);
+            }
+            slots.push_back(0xffff888104a2c000 + i * 0x100);
+            expectedAreas.push_back(slots.back());
+        }
+        setupRoot(encodeNode(0xffff888102000000, MapleType::maple_leaf_64));
+        setupNode(0xffff888102000000, MapleType::maple_leaf_64, pivots, slots);
+
+        EXPECT_EQ(collectVmAreas(), expectedAreas);
+    }
+
+    TEST_F(MapleTreeWalkerFixture, collectVmAreas_leafWithTaggedEntry_taggedEntrySkipped)
+    {
+        setupRoot(encodeNode(0xffff888102000000, MapleType::maple_leaf_64));
+        setupNode(0xffff888102000000,
+                  MapleType::maple_leaf_64,
+                  {0xfff, 0x1fff, 0x2fff, 0},
+                  {0xffff888104a2c000, 0xffff888104a2c102, 0xffff888104a2c200});
+
+        EXPECT_THAT(collectVmAreas(), ElementsAre(0xffff888104a2c000, 0xffff888104a2c200));
+    }
+
+    TEST_F(MapleTreeWalkerFixture, collectVmAreas_range64RootWithLeaves_areasInAddressOrder)
+    {
+        setupRoot(encodeNode(0xffff888102000000, MapleType::maple_range_64));
+        setupNode(0xffff888102000000,
+                  MapleType::maple_range_64,
+                  {0x7fffff, std::numeric_limits<uint64_t>::max()},
+                  {encodeNode(0xffff888102000100, MapleType::maple_leaf_64),
+                   encodeNode(0xffff888102000200, MapleType::maple_leaf_64)});
+        setupNode(0xffff888102000100, MapleType::maple_leaf_64, {0x400fff, 0x7fffff}, {0xffff888104a2c000, 0, 0});
+        setupNode(0xffff888102000200,
+                  MapleType::maple_leaf_64,
+                  {0x800fff, 0x900fff, 0},
+                  {0xffff888104a2c100, 0xffff888104a2c200});
+
+        EXPECT_THAT(collectVmAreas(), ElementsAre(0xffff888104a2c000, 0xffff888104a2c100, 0xffff888104a2c200));
+    }
+
+    TEST_F(MapleTreeWalkerFixture, collectVmAreas_arange64RootWithNestedNodes_areasInAddressOrder)
+    {
+        setupRoot(encodeNode(0xffff888102000000, MapleType::maple_arange_64));
+        setupNode(0xffff888102000000,
+                  MapleType::maple_arange_64,
+                  {0xffffff, std::numeric_limits<uint64_t>::max()},
+                  {encodeNode(0xffff888102000100, MapleType::maple_range_64),
+                   encodeNode(0xffff888102000400, MapleType::maple_leaf_64)});
+        setupNode(0xffff888102000100,
+                  MapleType::maple_range_64,
+                  {0x7fffff, 0xffffff},
+                  {encodeNode(0xffff888102000200, MapleType::maple_leaf_64),
+                   encodeNode(0xffff888102000300, MapleType::maple_leaf_64)});
+        setupNode(0xffff888102000200, MapleType::maple_leaf_64, {0x7fffff}, {0xffff888104a2c000});
+        setupNode(0xffff888102000300, MapleType::maple_leaf_64, {0xffffff}, {0xffff888104a2c100});
+        setupNode(0xffff888102000400, MapleType::maple_leaf_64, {0x1000fff, 0}, {0xffff888104a2c200, 0});
+
+        EXPECT_THAT(collectVmAreas(), ElementsAre(0xffff888104a2c000, 0xffff888104a2c100, 0xffff888104a2c200));
+    }
+
+    TEST_F(MapleTreeWalkerFixture, collectVmAreas_unsupportedNodeType_throws)
+    {
+        setupRoot(encodeNode(0xffff888102000000, MapleType::maple_dense));
+        setupNode(0xffff888102000000, MapleType::maple_leaf_64, {0}, {0xffff888104a2c000});
+
+        EXPECT_THROW(auto areas = collectVmAreas(), VmiException);
+    }
+
+    TEST_F(MapleTreeWalkerFixture, collectVmAreas_unreadableNode_throws)
+    {
+        setupRoot(encodeNode(0xffff888102000000, MapleType::maple_range_64));
+
+        EXPECT_THROW(auto areas = collectVmAreas(), VmiException);
+    }
+
+    TEST(MapleTreeWalkerTest, constructor_profileWithoutMapleTree_throws)
+    {
+        auto vmiInterface = std::make_shared<NiceMock<MockLibvmiInterface>>();
+
+        EXPECT_THROW(MapleTreeWalker walker(vmiInterface, KernelOffsets{}), VmiException);
+    }
+}
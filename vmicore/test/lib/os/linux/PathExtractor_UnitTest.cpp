@@ -0,0 +1,172 @@
+#include "../../io/mock_Logging.h"
+#include "../../vmi/mock_LibvmiInterface.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <map>
+#include <os/linux/PathExtractor.h>
+#include <vmicore_test/io/mock_Logger.h>
+
+using testing::_;
+using testing::AnyNumber;
+using testing::NiceMock;
+using testing::Return;
+
+namespace VmiCore::Linux
+{
+    namespace
+    {
+        constexpr uint64_t systemDtb = 0x1aa000;
+        constexpr uint64_t mountAddress = 0xffff888000010000;
+        constexpr uint64_t rootDentry = 0xffff888000020000;
+        constexpr uint64_t usrDentry = 0xffff888000021000;
+        constexpr uint64_t libDentry = 0xffff888000022000;
+        constexpr uint64_t libcDentry = 0xffff888000023000;
+        constexpr uint64_t libmDentry = 0xffff888000024000;
+        constexpr uint64_t renameLock = 0xffffffff82a0c040;
+        constexpr uint64_t pathAddress = 0xffff888000030000;
+        constexpr uint64_t nameOffset = 0x100;
+        constexpr uint64_t inodeOffset = 0x200;
+    }
+
+    class PathExtractorFixture : public testing::Test
+    {
+      protected:
+        std::shared_ptr<NiceMock<MockLibvmiInterface>> vmiInterface = std::make_shared<NiceMock<MockLibvmiInterface>>();
+        std::shared_ptr<NiceMock<MockLogging>> logging = std::make_shared<NiceMock<MockLogging>>();
+        std::shared_ptr<const KernelOffsets> kernelOffsets = std::make_shared<const KernelOffsets>(
+            KernelOffsets{.path = {.mnt = 0x0, .dentry = 0x8},
+                          .mount = {.mnt = 0x20, .mnt_mountpoint = 0x18, .mnt_parent = 0x10},
+                          .dentry = {.d_name = 0x20, .d_parent = 0x18, .d_inode = 0x30, .d_seq = 0x4},
+                          .qstr = {.name = 0x8},
+                          .renameLockVA = renameLock});
+        std::map<uint64_t, uint64_t> memory;
+        uint32_t renameSequence = 0;
+        std::map<uint64_t, std::string> names;
+
+        void SetUp() override
+        {
+            ON_CALL(*vmiInterface, convertPidToDtb(0)).WillByDefault(Return(systemDtb));
+            ON_CALL(*vmiInterface, read64VA(_, systemDtb))
+                .WillByDefault([this](uint64_t address, uint64_t) { return memory.at(address); });
+            ON_CALL(*vmiInterface, read32VA(renameLock, systemDtb))
+                .WillByDefault([this](uint64_t, uint64_t) { return renameSequence; });
+            ON_CALL(*vmiInterface, extractStringAtVA(_, systemDtb))
+                .WillByDefault([this](uint64_t address, uint64_t)
+                               { return std::make_unique<std::string>(names.at(address)); });
+            ON_CALL(*logging, newNamedLogger(_))
+                .WillByDefault([](std::string_view) { return std::make_unique<NiceMock<MockLogger>>(); });
+
+            memory[mountAddress + kernelOffsets->mount.mnt] = rootDentry;
+            memory[mountAddress + kernelOffsets->mount.mnt_parent] = mountAddress;
+            memory[mountAddress + kernelOffsets->mount.mnt_mountpoint] = rootDentry;
+            memory[pathAddress + kernelOffsets->path.mnt] = mountAddress + kernelOffsets->mount.mnt;
+            setupDentry(rootDentry, rootDentry, "/");
+            setupDentry(usrDentry, rootDentry, "usr");
+            setupDentry(libDentry, usrDentry, "lib");
+            setupDentry(libcDentry, libDentry, "libc.so.6");
+            setupDentry(libmDentry, libDentry, "libm.so.6");
+        }
+
+        void setupDentry(uint64_t dentry, uint64_t parent, const std::string& name)
+        {
+            memory[dentry + kernelOffsets->dentry.d_name + kernelOffsets->qstr.name] = dentry + nameOffset;
+            memory[dentry + kernelOffsets->dentry.d_parent] = parent;
+            memory[dentry + kernelOffsets->dentry.d_inode] = dentry + inodeOffset;
+            names[dentry + nameOffset] = name;
+        }
+
+        std::string extractPathOf(const PathExtractor& pathExtractor, uint64_t dentry)
+        {
+            memory[pathAddress + kernelOffsets->path.dentry] = dentry;
+            return pathExtractor.extractDPath(pathAddress);
+        }
+    };
+
+    TEST_F(PathExtractorFixture, extractDPath_nestedFile_fullPath)
+    {
+        PathExtractor pathExtractor(vmiInterface, kernelOffsets, std::make_shared<DentryPathCache>(), logging);
+
+        EXPECT_EQ(extractPathOf(pathExtractor, libcDentry), "/usr/lib/libc.so.6");
+    }
+
+    TEST_F(PathExtractorFixture, extractDPath_dPathReadBeforeFileReleased_fullPath)
+    {
+        PathExtractor pathExtractor(vmiInterface, kernelOffsets, std::make_shared<DentryPathCache>(), logging);
+        memory[pathAddress + kernelOffsets->path.dentry] = libcDentry;
+        auto dPath = pathExtractor.readDPath(pathAddress);
+
+        memory.erase(pathAddress + kernelOffsets->path.mnt);
+        memory.erase(pathAddress + kernelOffsets->path.dentry);
+
+        EXPECT_EQ(pathExtractor.extractDPath(dPath), "/usr/lib/libc.so.6");
+    }
+
+    TEST_F(PathExtractorFixture, extractDPath_siblingOfResolvedFile_onlyOwnNameExtracted)
+    {
+        PathExtractor pathExtractor(vmiInterface, kernelOffsets, std::make_shared<DentryPathCache>(), logging);
+        ASSERT_EQ(extractPathOf(pathExtractor, libcDentry), "/usr/lib/libc.so.6");
+
+        EXPECT_CALL(*vmiInterface, extractStringAtVA(_, _)).Times(0);
+        EXPECT_CALL(*vmiInterface, extractStringAtVA(libmDentry + nameOffset, systemDtb)).Times(1);
+
+        EXPECT_EQ(extractPathOf(pathExtractor, libmDentry), "/usr/lib/libm.so.6");
+    }
+
+    TEST_F(PathExtractorFixture, extractDPath_siblingOfResolvedFile_ancestorsAboveParentNotRead)
+    {
+        PathExtractor pathExtractor(vmiInterface, kernelOffsets, std::make_shared<DentryPathCache>(), logging);
+        ASSERT_EQ(extractPathOf(pathExtractor, libcDentry), "/usr/lib/libc.so.6");
+
+        EXPECT_CALL(*vmiInterface, read64VA(_, _)).Times(AnyNumber());
+        EXPECT_CALL(*vmiInterface, read64VA(usrDentry + kernelOffsets->dentry.d_parent, _)).Times(0);
+        EXPECT_CALL(*vmiInterface, read64VA(rootDentry + kernelOffsets->dentry.d_parent, _)).Times(0);
+
+        EXPECT_EQ(extractPathOf(pathExtractor, libmDentry), "/usr/lib/libm.so.6");
+    }
+
+    TEST_F(PathExtractorFixture, extractDPath_parentDirectoryRenamed_pathOfRenamedParent)
+    {
+        PathExtractor pathExtractor(vmiInterface, kernelOffsets, std::make_shared<DentryPathCache>(), logging);
+        ASSERT_EQ(extractPathOf(pathExtractor, libcDentry), "/usr/lib/libc.so.6");
+
+        setupDentry(usrDentry, rootDentry, "opt");
+        ON_CALL(*vmiInterface, read32VA(usrDentry + *kernelOffsets->dentry.d_seq, systemDtb)).WillByDefault(Return(2));
+        renameSequence = 2;
+
+        EXPECT_EQ(extractPathOf(pathExtractor, libcDentry), "/opt/lib/libc.so.6");
+    }
+
+    TEST_F(PathExtractorFixture, extractDPath_renameInProgress_pathNotCached)
+    {
+        renameSequence = 1;
+        PathExtractor pathExtractor(vmiInterface, kernelOffsets, std::make_shared<DentryPathCache>(), logging);
+        ASSERT_EQ(extractPathOf(pathExtractor, libcDentry), "/usr/lib/libc.so.6");
+        renameSequence = 2;
+
+        EXPECT_CALL(*vmiInterface, extractStringAtVA(_, _)).Times(AnyNumber());
+        EXPECT_CALL(*vmiInterface, extractStringAtVA(usrDentry + nameOffset, systemDtb)).Times(1);
+
+        EXPECT_EQ(extractPathOf(pathExtractor, libmDentry), "/usr/lib/libm.so.6");
+    }
+
+    TEST_F(PathExtractorFixture, extractDPath_dentryReusedForOtherFile_pathOfNewFile)
+    {
+        PathExtractor pathExtractor(vmiInterface, kernelOffsets, std::make_shared<DentryPathCache>(), logging);
+        ASSERT_EQ(extractPathOf(pathExtractor, libcDentry), "/usr/lib/libc.so.6");
+
+        // The reallocated dentry keeps its inline name buffer and starts over with the same sequence count
+        setupDentry(libcDentry, usrDentry, "libc.so.6");
+        names[libcDentry + nameOffset] = "bash";
+        memory[libcDentry + kernelOffsets->dentry.d_inode] = libcDentry + inodeOffset + 0x10;
+
+        EXPECT_EQ(extractPathOf(pathExtractor, libcDentry), "/usr/bash");
+    }
+
+    TEST_F(PathExtractorFixture, extractDPath_dentryLoop_terminates)
+    {
+        setupDentry(libDentry, libcDentry, "lib");
+        PathExtractor pathExtractor(vmiInterface, kernelOffsets, std::make_shared<DentryPathCache>(), logging);
+
+        EXPECT_NO_THROW(auto path = extractPathOf(pathExtractor, libcDentry));
+    }
+}
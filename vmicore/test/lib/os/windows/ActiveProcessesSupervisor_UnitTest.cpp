@@ -3,6 +3,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+using testing::_;
 using testing::Contains;
 using testing::Not;
 using testing::StrEq;
@@ -69,7 +70,7 @@ namespace VmiCore::Windows
 
         EXPECT_NO_THROW(activeProcessesSupervisor->addNewProcess(process332.eprocessBase));
 
-        std::unique_ptr<std::vector<std::shared_ptr<const ActiveProcessInformation>>> activeProcesses;
+        std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>> activeProcesses;
         EXPECT_NO_THROW(activeProcesses = activeProcessesSupervisor->getActiveProcesses());
         EXPECT_THAT(*activeProcesses, Contains(IsEqualProcess(process332)));
     }
@@ -88,13 +89,32 @@ namespace VmiCore::Windows
         EXPECT_NO_THROW(activeProcessesSupervisor->addNewProcess(process332.eprocessBase));
     }
 
+    TEST_F(ActiveProcessesSupervisorFixture, addNewProcess_process332_processPathExtractedWhileProcessAlive)
+    {
+        EXPECT_NO_THROW(activeProcessesSupervisor->initialize());
+        setupProcessWithLink(process332, process0.eprocessBase);
+
+        EXPECT_CALL(*mockVmiInterface, extractUnicodeStringAtVA(_, _)).Times(1);
+        EXPECT_NO_THROW(activeProcessesSupervisor->addNewProcess(process332.eprocessBase));
+    }
+
+    TEST_F(ActiveProcessesSupervisorFixture, getProcessInformationByPid_processPathAccessed_noGuestReads)
+    {
+        EXPECT_NO_THROW(activeProcessesSupervisor->initialize());
+        auto processInformation = activeProcessesSupervisor->getProcessInformationByPid(process248.processId);
+
+        EXPECT_CALL(*mockVmiInterface, extractUnicodeStringAtVA(_, _)).Times(0);
+        EXPECT_EQ(*processInformation->fullName, process248.fullName);
+        EXPECT_EQ(*processInformation->processPath, process248.filePath);
+    }
+
     TEST_F(ActiveProcessesSupervisorFixture, removeActiveProcess_presentProcess_processRemoved)
     {
         EXPECT_NO_THROW(activeProcessesSupervisor->initialize());
 
         EXPECT_NO_THROW(activeProcessesSupervisor->removeActiveProcess(process248.eprocessBase));
 
-        std::unique_ptr<std::vector<std::shared_ptr<const ActiveProcessInformation>>> activeProcesses;
+        std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>> activeProcesses;
         EXPECT_NO_THROW(activeProcesses = activeProcessesSupervisor->getActiveProcesses());
         EXPECT_THAT(*activeProcesses, Not(Contains(IsEqualProcess(process248))));
     }
@@ -118,11 +138,34 @@ namespace VmiCore::Windows
 
         EXPECT_NO_THROW(activeProcessesSupervisor->removeActiveProcess(process332.eprocessBase));
 
-        std::unique_ptr<std::vector<std::shared_ptr<const ActiveProcessInformation>>> activeProcesses;
+        std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>> activeProcesses;
         EXPECT_NO_THROW(activeProcesses = activeProcessesSupervisor->getActiveProcesses());
         EXPECT_THAT(*activeProcesses, UnorderedElementsAre(IsEqualProcess(process4), IsEqualProcess(process248)));
     }
 
+    TEST_F(ActiveProcessesSupervisorFixture, getActiveProcesses_repeatedCalls_noGuestReadsAndSameSnapshot)
+    {
+        EXPECT_NO_THROW(activeProcessesSupervisor->initialize());
+
+        EXPECT_CALL(*mockVmiInterface, read32VA(_, _)).Times(0);
+        EXPECT_CALL(*mockVmiInterface, read64VA(_, _)).Times(0);
+        auto firstSnapshot = activeProcessesSupervisor->getActiveProcesses();
+        auto secondSnapshot = activeProcessesSupervisor->getActiveProcesses();
+
+        EXPECT_EQ(firstSnapshot, secondSnapshot);
+    }
+
+    TEST_F(ActiveProcessesSupervisorFixture, removeActiveProcess_presentProcess_previousSnapshotUnchanged)
+    {
+        EXPECT_NO_THROW(activeProcessesSupervisor->initialize());
+        auto previousSnapshot = activeProcessesSupervisor->getActiveProcesses();
+
+        EXPECT_NO_THROW(activeProcessesSupervisor->removeActiveProcess(process248.eprocessBase));
+
+        EXPECT_THAT(*previousSnapshot, UnorderedElementsAre(IsEqualProcess(process4), IsEqualProcess(process248)));
+        EXPECT_THAT(*activeProcessesSupervisor->getActiveProcesses(), UnorderedElementsAre(IsEqualProcess(process4)));
+    }
+
     TEST_F(ActiveProcessesSupervisorFixture, getProcessInformationByPid_validPid_correctProcessInformation)
     {
         EXPECT_NO_THROW(activeProcessesSupervisor->initialize());
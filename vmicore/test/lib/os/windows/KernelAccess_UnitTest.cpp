@@ -34,4 +34,18 @@ namespace VmiCore
         EXPECT_THROW(auto filename = kernelAccess->extractFileName(~PagingDefinitions::kernelspaceLowerBoundary),
                      std::invalid_argument);
     }
+
+    TEST(KernelStructOffsetsTest, flagExtract_multiBitFlag_correctValue)
+    {
+        Windows::KernelStructOffsets::_flag flag{std::make_tuple(0, 3, 8)};
+
+        EXPECT_EQ(flag.extract(0b1110'1101'1000), 0b1'1011);
+    }
+
+    TEST(KernelStructOffsetsTest, flagExtract_fullWidthFlag_unchangedValue)
+    {
+        Windows::KernelStructOffsets::_flag flag{std::make_tuple(0, 0, 64)};
+
+        EXPECT_EQ(flag.extract(0xFFFF'0000'FFFF'0000), 0xFFFF'0000'FFFF'0000);
+    }
 }
@@ -54,8 +54,8 @@ namespace VmiCore
                             0,
                             0,
                             "",
-                            std::make_unique<std::string>(""),
-                            std::make_unique<std::string>(""),
+                            std::string(""),
+                            std::string(""),
                             std::make_unique<NiceMock<MockMemoryRegionExtractor>>());
                     });
         }
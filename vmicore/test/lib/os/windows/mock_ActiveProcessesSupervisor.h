@@ -17,11 +17,13 @@ namespace VmiCore
                     (uint64_t),
                     (const override));
 
+        MOCK_METHOD(std::optional<ThreadInformation>, getThreadInformationByBase, (uint64_t), (const override));
+
         MOCK_METHOD(void, addNewProcess, (uint64_t), (override));
 
         MOCK_METHOD(void, removeActiveProcess, (uint64_t), (override));
 
-        MOCK_METHOD(std::unique_ptr<std::vector<std::shared_ptr<const ActiveProcessInformation>>>,
+        MOCK_METHOD(std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>>,
                     getActiveProcesses,
                     (),
                     (const override));
@@ -1,6 +1,11 @@
 #include "../vmi/ProcessesMemoryState.h"
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <memory>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 using testing::_;
 using testing::Return;
@@ -9,6 +14,32 @@ using testing::Unused;
 
 namespace VmiCore
 {
+    namespace
+    {
+        std::function<void(Plugin::PluginInterface*)> stubPluginInitAction;
+        std::function<void()> stubPluginUnloadAction;
+
+        class StubPlugin : public Plugin::IPlugin
+        {
+          public:
+            void unload() override
+            {
+                if (stubPluginUnloadAction)
+                {
+                    stubPluginUnloadAction();
+                }
+            }
+        };
+
+        std::unique_ptr<Plugin::IPlugin> initStubPlugin(Plugin::PluginInterface* pluginInterface,
+                                                        [[maybe_unused]] std::shared_ptr<Plugin::IPluginConfig> config,
+                                                        [[maybe_unused]] std::vector<std::string> args)
+        {
+            stubPluginInitAction(pluginInterface);
+            return std::make_unique<StubPlugin>();
+        }
+    }
+
     class PluginSystemFixture : public ProcessesMemoryStateFixture
     {
       protected:
@@ -26,6 +57,23 @@ namespace VmiCore
 
             activeProcessesSupervisor->initialize();
         }
+
+        void TearDown() override
+        {
+            stubPluginInitAction = nullptr;
+            stubPluginUnloadAction = nullptr;
+            ProcessesMemoryStateFixture::TearDown();
+        }
+    };
+
+    class PluginSystemSmallSnapshotLimitFixture : public PluginSystemFixture
+    {
+      protected:
+        void SetUp() override
+        {
+            snapshotMemoryLimit = PagingDefinitions::pageSizeInBytes;
+            PluginSystemFixture::SetUp();
+        }
     };
 
     MATCHER_P(IsEqualMemoryRegion, expectedRegion, "")
@@ -92,7 +140,7 @@ namespace VmiCore
 
     TEST_F(PluginSystemFixture, getRunningProcesses_queryMemoryRegionsOfValidProcessWithVadTreeCycle_validMemoryRegions)
     {
-        std::unique_ptr<std::vector<std::shared_ptr<const ActiveProcessInformation>>> processes;
+        std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>> processes;
 
         ASSERT_NO_THROW(processes = pluginInterface->getRunningProcesses());
         auto process4Info =
@@ -109,7 +157,7 @@ namespace VmiCore
 
     TEST_F(PluginSystemFixture, getRunningProcesses_validInternalState_CorrectProcesses)
     {
-        std::unique_ptr<std::vector<std::shared_ptr<const ActiveProcessInformation>>> processes;
+        std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>> processes;
 
         ASSERT_NO_THROW(processes = pluginInterface->getRunningProcesses());
 
@@ -119,7 +167,7 @@ namespace VmiCore
 
     TEST_F(PluginSystemFixture, getRunningProcesses_process4_region2IsSharedMemory)
     {
-        std::unique_ptr<std::vector<std::shared_ptr<const ActiveProcessInformation>>> processes;
+        std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>> processes;
 
         ASSERT_NO_THROW(processes = pluginInterface->getRunningProcesses());
         auto process4Info =
@@ -134,7 +182,7 @@ namespace VmiCore
 
     TEST_F(PluginSystemFixture, getRunningProcesses_process4_region3IsPrivateMemory)
     {
-        std::unique_ptr<std::vector<std::shared_ptr<const ActiveProcessInformation>>> processes;
+        std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>> processes;
 
         ASSERT_NO_THROW(processes = pluginInterface->getRunningProcesses());
         auto process4Info =
@@ -151,7 +199,7 @@ namespace VmiCore
 
     TEST_F(PluginSystemFixture, getRunningProcesses_process4_region2IsProcessBaseImage)
     {
-        std::unique_ptr<std::vector<std::shared_ptr<const ActiveProcessInformation>>> processes;
+        std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>> processes;
 
         ASSERT_NO_THROW(processes = pluginInterface->getRunningProcesses());
         auto process4Info =
@@ -166,7 +214,7 @@ namespace VmiCore
 
     TEST_F(PluginSystemFixture, getRunningProcesses_process4_region3IsNotProcessBaseImage)
     {
-        std::unique_ptr<std::vector<std::shared_ptr<const ActiveProcessInformation>>> processes;
+        std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>> processes;
 
         ASSERT_NO_THROW(processes = pluginInterface->getRunningProcesses());
         auto process4Info =
@@ -183,7 +231,7 @@ namespace VmiCore
 
     TEST_F(PluginSystemFixture, getRunningProcesses_process4WithHighVPNRegion_hasCorrectBaseAddress)
     {
-        std::unique_ptr<std::vector<std::shared_ptr<const ActiveProcessInformation>>> processes;
+        std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>> processes;
 
         ASSERT_NO_THROW(processes = pluginInterface->getRunningProcesses());
         auto process4Info =
@@ -200,7 +248,7 @@ namespace VmiCore
 
     TEST_F(PluginSystemFixture, getRunningProcesses_process4WithHighVPNRegion_hasCorrectSize)
     {
-        std::unique_ptr<std::vector<std::shared_ptr<const ActiveProcessInformation>>> processes;
+        std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>> processes;
 
         ASSERT_NO_THROW(processes = pluginInterface->getRunningProcesses());
         auto process4Info =
@@ -214,4 +262,138 @@ namespace VmiCore
         std::advance(regionIterator, 2);
         EXPECT_EQ(regionIterator->size, vadRootNodeLeftChildMemoryRegionSize);
     }
+
+    TEST_F(PluginSystemFixture, passProcessStartEventToRegisteredPlugins_asyncCallback_deliveredOnWorkerInOrder)
+    {
+        std::vector<pid_t> deliveredPids;
+        std::thread::id deliveringThread;
+        stubPluginInitAction = [&deliveredPids, &deliveringThread](Plugin::PluginInterface* initializedPluginInterface)
+        {
+            initializedPluginInterface->registerProcessStartEvent(
+                [&deliveredPids, &deliveringThread](const std::shared_ptr<const ActiveProcessInformation>& process)
+                {
+                    deliveredPids.push_back(process->pid);
+                    deliveringThread = std::this_thread::get_id();
+                },
+                Plugin::EventDelivery::Asynchronous);
+        };
+        pluginSystem->runPluginInit("stubPlugin", initStubPlugin, {}, {});
+
+        for (const auto& process : *pluginInterface->getRunningProcesses())
+        {
+            pluginSystem->passProcessStartEventToRegisteredPlugins(process);
+        }
+        pluginSystem->unloadPlugins();
+
+        std::vector<pid_t> expectedPids;
+        for (const auto& process : *pluginInterface->getRunningProcesses())
+        {
+            expectedPids.push_back(process->pid);
+        }
+        EXPECT_EQ(deliveredPids, expectedPids);
+        EXPECT_NE(deliveringThread, std::this_thread::get_id());
+    }
+
+    TEST_F(PluginSystemFixture, registerProcessStartEvent_asyncOutsidePluginInit_throws)
+    {
+        auto callback = [](const std::shared_ptr<const ActiveProcessInformation>&) {};
+
+        EXPECT_THROW(pluginInterface->registerProcessStartEvent(callback, Plugin::EventDelivery::Asynchronous),
+                     std::runtime_error);
+    }
+
+    TEST_F(PluginSystemFixture, passProcessTerminationEventToRegisteredPlugins_asyncCallbackDuringUnload_eventDropped)
+    {
+        bool delivered = false;
+        stubPluginInitAction = [&delivered](Plugin::PluginInterface* initializedPluginInterface)
+        {
+            initializedPluginInterface->registerProcessTerminationEvent(
+                [&delivered](const std::shared_ptr<const ActiveProcessInformation>&) { delivered = true; },
+                Plugin::EventDelivery::Asynchronous);
+        };
+        stubPluginUnloadAction = [this]()
+        {
+            EXPECT_NO_THROW(pluginSystem->passProcessTerminationEventToRegisteredPlugins(
+                activeProcessesSupervisor->getSystemProcessInformation()));
+        };
+        pluginSystem->runPluginInit("stubPlugin", initStubPlugin, {}, {});
+
+        pluginSystem->unloadPlugins();
+
+        EXPECT_FALSE(delivered);
+    }
+
+    TEST_F(PluginSystemFixture, passProcessTerminationEventToRegisteredPlugins_syncCallback_deliveredImmediately)
+    {
+        bool delivered = false;
+        pluginInterface->registerProcessTerminationEvent(
+            [&delivered](const std::shared_ptr<const ActiveProcessInformation>&) { delivered = true; },
+            Plugin::EventDelivery::Synchronous);
+
+        pluginSystem->passProcessTerminationEventToRegisteredPlugins(
+            activeProcessesSupervisor->getSystemProcessInformation());
+
+        EXPECT_TRUE(delivered);
+    }
+
+    TEST_F(PluginSystemFixture, passThreadStartEventToRegisteredPlugins_registeredCallback_threadOfProcessDelivered)
+    {
+        std::optional<ThreadInformation> deliveredThread;
+        pluginInterface->registerThreadStartEvent([&deliveredThread](const ThreadInformation& threadInformation)
+                                                  { deliveredThread = threadInformation; });
+
+        pluginSystem->passThreadStartEventToRegisteredPlugins({.base = 0x1000, .threadId = 5, .pid = 4});
+
+        ASSERT_TRUE(deliveredThread);
+        EXPECT_EQ(deliveredThread->threadId, 5);
+        EXPECT_EQ(deliveredThread->pid, 4);
+    }
+
+    TEST_F(PluginSystemFixture, snapshotProcessMemory_filterSelectsSingleRegion_onlySelectedRegionCopied)
+    {
+        auto processes = pluginInterface->getRunningProcesses();
+        auto process4Info =
+            *std::find_if(processes->cbegin(),
+                          processes->cend(),
+                          [process4 = process4](const std::shared_ptr<const ActiveProcessInformation>& a)
+                          { return a->pid == process4.processId; });
+        auto guestPage = std::vector<uint8_t>(PagingDefinitions::pageSizeInBytes, 0xAB);
+        auto libvmiMapping = mapped_region_t{.start_va = expectedMemoryRegion1.base,
+                                             .num_pages = 1,
+                                             .access_ptr = static_cast<void*>(guestPage.data())};
+        mapped_regions_t libvmiMappings{};
+        libvmiMappings.regions = &libvmiMapping;
+        libvmiMappings.size = 1;
+        EXPECT_CALL(*mockVmiInterface, mmapGuest(expectedMemoryRegion1.base, _, _)).WillOnce(Return(libvmiMappings));
+        EXPECT_CALL(*mockVmiInterface, freeMappedRegions(_)).Times(1);
+
+        auto snapshot = pluginInterface->snapshotProcessMemory(
+            *process4Info,
+            [base = expectedMemoryRegion1.base](const MemoryRegion& memoryRegion)
+            { return memoryRegion.base == base; });
+        std::ranges::fill(guestPage, 0);
+
+        ASSERT_EQ(snapshot->getRegions().size(), 1);
+        EXPECT_THAT(snapshot->getRegions()[0].memoryRegionDescriptor, IsEqualMemoryRegion(&expectedMemoryRegion1));
+        ASSERT_EQ(snapshot->getRegions()[0].mappedRegions.size(), 1);
+        auto content = snapshot->getRegions()[0].mappedRegions[0].asSpan();
+        EXPECT_TRUE(std::ranges::all_of(content, [](uint8_t b) { return b == 0xAB; }));
+    }
+
+    TEST_F(PluginSystemSmallSnapshotLimitFixture, snapshotProcessMemory_regionsExceedLimit_throwsWithoutMapping)
+    {
+        auto processes = pluginInterface->getRunningProcesses();
+        auto process4Info =
+            *std::find_if(processes->cbegin(),
+                          processes->cend(),
+                          [process4 = process4](const std::shared_ptr<const ActiveProcessInformation>& a)
+                          { return a->pid == process4.processId; });
+        EXPECT_CALL(*mockVmiInterface, mmapGuest(_, _, _)).Times(0);
+
+        EXPECT_THROW(auto snapshot = pluginInterface->snapshotProcessMemory(
+                         *process4Info,
+                         [base = expectedMemoryRegion1.base](const MemoryRegion& memoryRegion)
+                         { return memoryRegion.base == base; }),
+                     std::length_error);
+    }
 }
@@ -11,7 +11,12 @@ namespace VmiCore
                     (addr_t, addr_t, std::size_t),
                     (const override));
 
-        MOCK_METHOD(std::unique_ptr<std::vector<std::shared_ptr<const ActiveProcessInformation>>>,
+        MOCK_METHOD(std::unique_ptr<IMemorySnapshot>,
+                    snapshotProcessMemory,
+                    (const ActiveProcessInformation&, const std::function<bool(const MemoryRegion&)>&),
+                    (const override));
+
+        MOCK_METHOD(std::shared_ptr<const std::vector<std::shared_ptr<const ActiveProcessInformation>>>,
                     getRunningProcesses,
                     (),
                     (const override));
@@ -21,11 +26,30 @@ namespace VmiCore
                     (const std::function<void(std::shared_ptr<const ActiveProcessInformation>)>&),
                     (override));
 
+        MOCK_METHOD(void,
+                    registerProcessStartEvent,
+                    (const std::function<void(std::shared_ptr<const ActiveProcessInformation>)>&,
+                     Plugin::EventDelivery),
+                    (override));
+
         MOCK_METHOD(void,
                     registerProcessTerminationEvent,
                     (const std::function<void(std::shared_ptr<const ActiveProcessInformation>)>&),
                     (override));
 
+        MOCK_METHOD(void,
+                    registerProcessTerminationEvent,
+                    (const std::function<void(std::shared_ptr<const ActiveProcessInformation>)>&,
+                     Plugin::EventDelivery),
+                    (override));
+
+        MOCK_METHOD(void, registerThreadStartEvent, (const std::function<void(const ThreadInformation&)>&), (override));
+
+        MOCK_METHOD(void,
+                    registerThreadTerminationEvent,
+                    (const std::function<void(const ThreadInformation&)>&),
+                    (override));
+
         MOCK_METHOD(std::shared_ptr<IBreakpoint>,
                     createBreakpoint,
                     (uint64_t, const ActiveProcessInformation&, const std::function<BpResponse(IInterruptEvent&)>&),
@@ -39,6 +63,13 @@ namespace VmiCore
 
         MOCK_METHOD(void, writeToFile, (const std::string&, const std::vector<uint8_t>&), (const override));
 
+        MOCK_METHOD(void, appendToFile, (const std::string&, std::span<const uint8_t>), (const override));
+
+        MOCK_METHOD(void,
+                    writeSegmentsToFile,
+                    (const std::string&, std::span<const FileSegment>, std::size_t),
+                    (const override));
+
         MOCK_METHOD(void, sendErrorEvent, (std::string_view), (const override));
 
         MOCK_METHOD(void, sendInMemDetectionEvent, (std::string_view), (const override));
@@ -58,6 +89,10 @@ namespace VmiCore
                     (std::shared_ptr<const ActiveProcessInformation>),
                     (override));
 
+        MOCK_METHOD(void, passThreadStartEventToRegisteredPlugins, (const ThreadInformation&), (override));
+
+        MOCK_METHOD(void, passThreadTerminationEventToRegisteredPlugins, (const ThreadInformation&), (override));
+
         MOCK_METHOD(void, unloadPlugins, (), (override));
 
         MOCK_METHOD(std::shared_ptr<IIntrospectionAPI>, getIntrospectionAPI, (), (const override));
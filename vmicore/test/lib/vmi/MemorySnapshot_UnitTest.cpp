@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vmi/MemorySnapshot.h>
+#include <vmicore/os/PagingDefinitions.h>
+#include <vmicore_test/os/mock_PageProtection.h>
+#include <vmicore_test/vmi/mock_MemoryMapping.h>
+
+using testing::Return;
+using VmiCore::PagingDefinitions::pageSizeInBytes;
+
+namespace VmiCore
+{
+    class MemorySnapshotFixture : public testing::Test
+    {
+      protected:
+        std::shared_ptr<SnapshotArenaPool> arenaPool = std::make_shared<SnapshotArenaPool>(16 * 1024 * 1024);
+        addr_t regionBase = 0x1000000;
+        std::vector<uint8_t> firstPage = std::vector<uint8_t>(pageSizeInBytes, 0x11);
+        std::vector<uint8_t> secondPages = std::vector<uint8_t>(2 * pageSizeInBytes, 0x22);
+        std::vector<MappedRegion> mappedRegions{{regionBase, firstPage},
+                                                {regionBase + 3 * pageSizeInBytes, secondPages}};
+
+        std::vector<std::pair<MemoryRegion, std::unique_ptr<IMemoryMapping>>> createMemoryRegionMappings()
+        {
+            auto memoryMapping = std::make_unique<MockMemoryMapping>();
+            ON_CALL(*memoryMapping, getMappedRegions()).WillByDefault(Return(mappedRegions));
+            EXPECT_CALL(*memoryMapping, unmap()).Times(1);
+
+            std::vector<std::pair<MemoryRegion, std::unique_ptr<IMemoryMapping>>> memoryRegionMappings;
+            memoryRegionMappings.emplace_back(
+                MemoryRegion{
+                    regionBase, 5 * pageSizeInBytes, "", std::make_unique<MockPageProtection>(), false, false, false},
+                std::move(memoryMapping));
+            return memoryRegionMappings;
+        }
+    };
+
+    TEST_F(MemorySnapshotFixture, create_guestMemoryChangedAfterwards_snapshotContainsOriginalContent)
+    {
+        auto snapshot = MemorySnapshot::create(*arenaPool, createMemoryRegionMappings());
+        std::ranges::fill(firstPage, 0);
+        std::ranges::fill(secondPages, 0);
+
+        ASSERT_EQ(snapshot->getRegions().size(), 1);
+        auto snapshotMappedRegions = snapshot->getRegions()[0].mappedRegions;
+        ASSERT_EQ(snapshotMappedRegions.size(), 2);
+        EXPECT_EQ(snapshotMappedRegions[0].guestBaseVA, regionBase);
+        EXPECT_TRUE(std::ranges::all_of(snapshotMappedRegions[0].asSpan(), [](uint8_t b) { return b == 0x11; }));
+        EXPECT_EQ(snapshotMappedRegions[1].guestBaseVA, regionBase + 3 * pageSizeInBytes);
+        EXPECT_EQ(snapshotMappedRegions[1].num_pages, 2);
+        EXPECT_TRUE(std::ranges::all_of(snapshotMappedRegions[1].asSpan(), [](uint8_t b) { return b == 0x22; }));
+        EXPECT_EQ(snapshot->size(), 3 * pageSizeInBytes);
+    }
+
+    TEST_F(MemorySnapshotFixture, create_noMappedMemory_emptySnapshotWithoutArena)
+    {
+        auto snapshot = MemorySnapshot::create(*arenaPool, {});
+
+        EXPECT_TRUE(snapshot->getRegions().empty());
+        EXPECT_EQ(arenaPool->getAllocatedBytes(), 0);
+    }
+
+    TEST_F(MemorySnapshotFixture, create_memoryLimitTakenByOtherSnapshot_throwsWithoutWaiting)
+    {
+        auto otherLease = arenaPool->acquire(arenaPool->getMemoryLimit());
+        auto memoryMapping = std::make_unique<MockMemoryMapping>();
+        ON_CALL(*memoryMapping, getMappedRegions()).WillByDefault(Return(mappedRegions));
+        std::vector<std::pair<MemoryRegion, std::unique_ptr<IMemoryMapping>>> memoryRegionMappings;
+        memoryRegionMappings.emplace_back(
+            MemoryRegion{
+                regionBase, 5 * pageSizeInBytes, "", std::make_unique<MockPageProtection>(), false, false, false},
+            std::move(memoryMapping));
+
+        EXPECT_THROW(auto snapshot = MemorySnapshot::create(*arenaPool, std::move(memoryRegionMappings)),
+                     std::length_error);
+    }
+
+    TEST_F(MemorySnapshotFixture, destructor_snapshotDestroyed_arenaReturnedToPool)
+    {
+        auto snapshot = MemorySnapshot::create(*arenaPool, createMemoryRegionMappings());
+        auto* arenaBase = snapshot->getRegions()[0].mappedRegions[0].mappingBase;
+        snapshot.reset();
+
+        auto lease = arenaPool->acquire(pageSizeInBytes);
+
+        EXPECT_EQ(lease.data().data(), arenaBase);
+    }
+}
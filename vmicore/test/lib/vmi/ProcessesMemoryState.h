@@ -340,6 +340,7 @@ namespace VmiCore
         }
 
         std::filesystem::path pluginDirectory = "/var/lib/test";
+        std::size_t snapshotMemoryLimit = 16 * 1024 * 1024;
         std::shared_ptr<testing::NiceMock<MockConfigInterface>> mockConfigInterface =
             std::make_shared<testing::NiceMock<MockConfigInterface>>();
         std::shared_ptr<testing::NiceMock<MockLegacyLogging>> mockLegacyLogging =
@@ -350,6 +351,7 @@ namespace VmiCore
         void setupReturnsForConfigInterface()
         {
             ON_CALL(*mockConfigInterface, getPluginDirectory()).WillByDefault(testing::Return(pluginDirectory));
+            ON_CALL(*mockConfigInterface, getSnapshotMemoryLimit()).WillByDefault(testing::Return(snapshotMemoryLimit));
         }
 
         uint64_t vadRootNodeBase = 666 + PagingDefinitions::kernelspaceLowerBoundary;
@@ -0,0 +1,101 @@
+#include <chrono>
+#include <future>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vmi/SnapshotArenaPool.h>
+
+namespace VmiCore
+{
+    namespace
+    {
+        constexpr std::size_t arenaSize = 2 * 1024 * 1024;
+    }
+
+    TEST(SnapshotArenaPoolTest, acquire_sizeExceedsMemoryLimit_throws)
+    {
+        auto pool = std::make_shared<SnapshotArenaPool>(arenaSize);
+
+        EXPECT_THROW(auto lease = pool->acquire(arenaSize + 1), std::length_error);
+    }
+
+    TEST(SnapshotArenaPoolTest, acquire_smallSize_roundedUpToHugePageSize)
+    {
+        auto pool = std::make_shared<SnapshotArenaPool>(arenaSize);
+
+        auto lease = pool->acquire(1);
+
+        EXPECT_EQ(lease.data().size(), arenaSize);
+    }
+
+    TEST(SnapshotArenaPoolTest, acquire_previousLeaseReturned_arenaReused)
+    {
+        auto pool = std::make_shared<SnapshotArenaPool>(2 * arenaSize);
+        uint8_t* firstArena = nullptr;
+        {
+            auto lease = pool->acquire(arenaSize);
+            firstArena = lease.data().data();
+        }
+
+        auto lease = pool->acquire(arenaSize);
+
+        EXPECT_EQ(lease.data().data(), firstArena);
+        EXPECT_EQ(pool->getAllocatedBytes(), arenaSize);
+    }
+
+    TEST(SnapshotArenaPoolTest, acquire_freeArenaTooSmall_freeArenaReleasedForLargerOne)
+    {
+        auto pool = std::make_shared<SnapshotArenaPool>(2 * arenaSize);
+        {
+            auto lease = pool->acquire(arenaSize);
+        }
+
+        auto lease = pool->acquire(2 * arenaSize);
+
+        EXPECT_EQ(lease.data().size(), 2 * arenaSize);
+        EXPECT_EQ(pool->getAllocatedBytes(), 2 * arenaSize);
+    }
+
+    TEST(SnapshotArenaPoolTest, acquire_memoryLimitReached_blocksUntilLeaseReturned)
+    {
+        auto pool = std::make_shared<SnapshotArenaPool>(arenaSize);
+        auto firstLease = std::make_optional(pool->acquire(arenaSize));
+
+        auto secondAcquire = std::async(std::launch::async, [&pool]() { return pool->acquire(arenaSize).data(); });
+        ASSERT_EQ(secondAcquire.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+        firstLease.reset();
+
+        EXPECT_EQ(secondAcquire.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+        EXPECT_EQ(pool->getAllocatedBytes(), arenaSize);
+    }
+
+    TEST(SnapshotArenaPoolTest, tryAcquire_memoryLimitReached_emptyWithoutWaiting)
+    {
+        auto pool = std::make_shared<SnapshotArenaPool>(arenaSize);
+        auto firstLease = pool->acquire(arenaSize);
+
+        auto secondLease = pool->tryAcquire(arenaSize);
+
+        EXPECT_FALSE(secondLease);
+        EXPECT_EQ(pool->getAllocatedBytes(), arenaSize);
+    }
+
+    TEST(SnapshotArenaPoolTest, tryAcquire_freeArenaAvailable_arenaReused)
+    {
+        auto pool = std::make_shared<SnapshotArenaPool>(arenaSize);
+        uint8_t* firstArena = nullptr;
+        {
+            auto lease = pool->acquire(arenaSize);
+            firstArena = lease.data().data();
+        }
+
+        auto lease = pool->tryAcquire(arenaSize);
+
+        ASSERT_TRUE(lease);
+        EXPECT_EQ(lease->data().data(), firstArena);
+    }
+
+    TEST(SnapshotArenaPoolTest, getArenaSize_sizeNotMultipleOfHugePageSize_roundedUp)
+    {
+        EXPECT_EQ(SnapshotArenaPool::getArenaSize(arenaSize + 1), 2 * arenaSize);
+    }
+}
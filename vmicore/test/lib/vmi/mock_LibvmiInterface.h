@@ -47,6 +47,8 @@ namespace VmiCore
 
         MOCK_METHOD(addr_t, convertVAToPA, (addr_t, addr_t), (override));
 
+        MOCK_METHOD(std::vector<FrameRun>, getFrameRuns, (addr_t, addr_t, std::size_t), (override));
+
         MOCK_METHOD(addr_t, convertPidToDtb, (pid_t), (override));
 
         MOCK_METHOD(pid_t, convertDtbToPid, (addr_t), (override));